@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_core/alloc_tracker.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+thread_local AllocDomain current_domain = AllocDomain::Other;
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+
+} // namespace
+
+const char* alloc_domain_to_str(AllocDomain domain) {
+    switch (domain) {
+    case AllocDomain::Other:
+        return "other";
+    case AllocDomain::Http:
+        return "http";
+    case AllocDomain::Json:
+        return "json";
+    case AllocDomain::Sensor:
+        return "sensor";
+    case AllocDomain::Storage:
+        return "storage";
+    default:
+        break;
+    }
+
+    return "<none>";
+}
+
+AllocTracker::Counter AllocTracker::counters_[static_cast<unsigned>(AllocDomain::Last)];
+
+void AllocTracker::record(AllocDomain domain, size_t size) {
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    Counter& counter = counters_[static_cast<unsigned>(domain)];
+
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.bytes.fetch_add(size, std::memory_order_relaxed);
+#else
+    (void)domain;
+    (void)size;
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+}
+
+AllocDomain AllocTracker::get_domain() {
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    return current_domain;
+#else
+    return AllocDomain::Other;
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+}
+
+void AllocTracker::set_domain(AllocDomain domain) {
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    current_domain = domain;
+#else
+    (void)domain;
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+}
+
+uint32_t AllocTracker::get_count(AllocDomain domain) {
+    configASSERT(domain < AllocDomain::Last);
+
+    return counters_[static_cast<unsigned>(domain)].count.load(std::memory_order_relaxed);
+}
+
+uint32_t AllocTracker::get_bytes(AllocDomain domain) {
+    configASSERT(domain < AllocDomain::Last);
+
+    return counters_[static_cast<unsigned>(domain)].bytes.load(std::memory_order_relaxed);
+}
+
+AllocScope::AllocScope(AllocDomain domain)
+    : prev_(AllocTracker::get_domain()) {
+    AllocTracker::set_domain(domain);
+}
+
+AllocScope::~AllocScope() {
+    AllocTracker::set_domain(prev_);
+}
+
+} // namespace bonsai
+} // namespace ocs
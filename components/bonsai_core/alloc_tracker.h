@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Subsystem to which the heap allocations are accounted.
+enum class AllocDomain : uint8_t {
+    //! Allocations made outside of any known subsystem.
+    Other,
+
+    //! Allocations made by the HTTP handlers.
+    Http,
+
+    //! Allocations made by cJSON, while the JSON data is formatted.
+    Json,
+
+    //! Allocations made by the sensor pipelines.
+    Sensor,
+
+    //! Allocations made while the data is read from or written to the storage.
+    Storage,
+
+    //! Number of domains.
+    Last,
+};
+
+//! Convert the domain to a human-readable string.
+const char* alloc_domain_to_str(AllocDomain domain);
+
+//! Per-domain heap allocation counters.
+//!
+//! @remarks
+//!  The counters are cumulative: the number of allocations and the number of bytes
+//!  allocated since boot. The allocation is accounted to the domain of the current
+//!  task, see AllocScope.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE is disabled, the counters are
+//!  always zero.
+class AllocTracker : public core::NonCopyable<> {
+public:
+    //! Account the allocation of @p size bytes to @p domain.
+    static void record(AllocDomain domain, size_t size);
+
+    //! Return the domain of the current task.
+    static AllocDomain get_domain();
+
+    //! Set the domain of the current task.
+    static void set_domain(AllocDomain domain);
+
+    //! Return the number of allocations made in @p domain.
+    static uint32_t get_count(AllocDomain domain);
+
+    //! Return the number of bytes allocated in @p domain.
+    static uint32_t get_bytes(AllocDomain domain);
+
+private:
+    struct Counter {
+        std::atomic<uint32_t> count { 0 };
+        std::atomic<uint32_t> bytes { 0 };
+    };
+
+    static Counter counters_[static_cast<unsigned>(AllocDomain::Last)];
+};
+
+//! Account all heap allocations of the current task to the domain.
+//!
+//! @remarks
+//!  The previous domain is restored when the scope is destroyed.
+class AllocScope : public core::NonCopyable<> {
+public:
+    //! Enter @p domain.
+    explicit AllocScope(AllocDomain domain);
+
+    //! Restore the previous domain.
+    ~AllocScope();
+
+private:
+    const AllocDomain prev_ { AllocDomain::Other };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+
+#include "bonsai_core/arena.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "arena";
+
+size_t align_up(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+Arena::Arena(void* buf, size_t size)
+    : begin_(static_cast<uint8_t*>(buf))
+    , end_(static_cast<uint8_t*>(buf) + size)
+    , pos_(static_cast<uint8_t*>(buf)) {
+    configASSERT(buf);
+    configASSERT(reinterpret_cast<uintptr_t>(buf) % alignment_ == 0);
+
+    begin("unknown");
+}
+
+void Arena::begin(const char* id) {
+    MutexLock lock(mu_);
+
+    for (unsigned n = 0; n < section_count_; ++n) {
+        if (strcmp(sections_[n].id, id) == 0) {
+            section_ = n;
+            return;
+        }
+    }
+
+    if (section_count_ == max_section_count) {
+        ocs_logw(log_tag, "too many sections, allocations are accounted to '%s'",
+                 sections_[section_].id);
+        return;
+    }
+
+    sections_[section_count_].id = id;
+    section_ = section_count_;
+    ++section_count_;
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    if (alignment < alignment_) {
+        alignment = alignment_;
+    }
+
+    configASSERT((alignment & (alignment - 1)) == 0);
+
+    const size_t data_size = align_up(size ? size : 1, alignment_);
+
+    MutexLock lock(mu_);
+
+    Section& section = sections_[section_];
+
+    void* ptr = reuse_(data_size, alignment);
+
+    if (!ptr) {
+        const size_t block_size = get_data_(pos_, alignment) - pos_ + data_size;
+
+        if (block_size > static_cast<size_t>(end_ - pos_)) {
+            ocs_loge(log_tag,
+                     "arena exhausted: section=%s requested=%u used=%u size=%u, "
+                     "increase CONFIG_BONSAI_FIRMWARE_ARENA_SIZE",
+                     section.id, static_cast<unsigned>(size),
+                     static_cast<unsigned>(get_used()),
+                     static_cast<unsigned>(get_size()));
+
+            return nullptr;
+        }
+
+        ptr = place_(pos_, block_size, alignment);
+        pos_ += block_size;
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(
+        static_cast<uint8_t*>(ptr) - align_up(sizeof(Header), alignment_));
+
+    section.size += header->size;
+    ++section.count;
+
+    return ptr;
+}
+
+void Arena::release(void* ptr) {
+    const size_t header_size = align_up(sizeof(Header), alignment_);
+
+    const Header* header =
+        reinterpret_cast<const Header*>(static_cast<uint8_t*>(ptr) - header_size);
+
+    // The header can be overwritten by the free list entry.
+    const size_t block_size = header->size;
+    uint8_t* block = static_cast<uint8_t*>(ptr) - header_size - header->offset;
+
+    MutexLock lock(mu_);
+
+    FreeBlock* free_block = reinterpret_cast<FreeBlock*>(block);
+    free_block->size = block_size;
+    free_block->next = free_list_;
+    free_list_ = free_block;
+
+    released_ += block_size;
+    free_ += block_size;
+}
+
+bool Arena::contains(const void* ptr) const {
+    const uint8_t* p = static_cast<const uint8_t*>(ptr);
+    return p >= begin_ && p < end_;
+}
+
+size_t Arena::get_size() const {
+    return end_ - begin_;
+}
+
+size_t Arena::get_used() const {
+    return pos_ - begin_;
+}
+
+size_t Arena::get_released() const {
+    return released_;
+}
+
+size_t Arena::get_free() const {
+    return free_;
+}
+
+unsigned Arena::get_section_count() const {
+    MutexLock lock(mu_);
+    return section_count_;
+}
+
+const Arena::Section& Arena::get_section(unsigned index) const {
+    MutexLock lock(mu_);
+
+    configASSERT(index < section_count_);
+    return sections_[index];
+}
+
+void Arena::report() const {
+    MutexLock lock(mu_);
+
+    for (unsigned n = 0; n < section_count_; ++n) {
+        if (!sections_[n].count) {
+            continue;
+        }
+
+        ocs_logi(log_tag, "section=%s bytes=%u allocations=%u", sections_[n].id,
+                 static_cast<unsigned>(sections_[n].size), sections_[n].count);
+    }
+
+    ocs_logi(log_tag, "used=%u released=%u free=%u size=%u",
+             static_cast<unsigned>(get_used()), static_cast<unsigned>(get_released()),
+             static_cast<unsigned>(get_free()), static_cast<unsigned>(get_size()));
+}
+
+uint8_t* Arena::get_data_(uint8_t* block, size_t alignment) {
+    const uintptr_t data =
+        reinterpret_cast<uintptr_t>(block) + align_up(sizeof(Header), alignment_);
+
+    return reinterpret_cast<uint8_t*>(align_up(data, alignment));
+}
+
+void* Arena::reuse_(size_t data_size, size_t alignment) {
+    if (!free_list_) {
+        return nullptr;
+    }
+
+    // The rest of the split block should fit the header and the smallest data.
+    const size_t min_block_size = align_up(sizeof(Header), alignment_) + alignment_;
+
+    for (FreeBlock** link = &free_list_; *link; link = &(*link)->next) {
+        FreeBlock* free_block = *link;
+        uint8_t* block = reinterpret_cast<uint8_t*>(free_block);
+
+        size_t block_size = get_data_(block, alignment) - block + data_size;
+        if (block_size > free_block->size) {
+            continue;
+        }
+
+        if (free_block->size - block_size >= min_block_size) {
+            FreeBlock* rest = reinterpret_cast<FreeBlock*>(block + block_size);
+            rest->size = free_block->size - block_size;
+            rest->next = free_block->next;
+
+            *link = rest;
+        } else {
+            block_size = free_block->size;
+
+            *link = free_block->next;
+        }
+
+        free_ -= block_size;
+
+        return place_(block, block_size, alignment);
+    }
+
+    return nullptr;
+}
+
+void* Arena::place_(uint8_t* block, size_t block_size, size_t alignment) {
+    uint8_t* data = get_data_(block, alignment);
+
+    Header* header =
+        reinterpret_cast<Header*>(data - align_up(sizeof(Header), alignment_));
+    header->size = block_size;
+    header->offset = reinterpret_cast<uint8_t*>(header) - block;
+
+    return data;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Bump allocator with the free list over the fixed memory region.
+//!
+//! @remarks
+//!  Released blocks are kept in the free list and reused by the following
+//!  allocations, first fit, the larger blocks are split. Adjacent released blocks
+//!  aren't merged, so the short-lived allocations of different sizes still waste
+//!  some memory, see get_free().
+//!
+//!  All the methods are thread-safe: the allocations and the section switches are
+//!  serialized with the mutex, since the replaced operator new and delete can be
+//!  called concurrently from any task.
+class Arena : public core::NonCopyable<> {
+public:
+    //! Maximum number of accounted sections.
+    static constexpr unsigned max_section_count = 16;
+
+    //! Arena section, a group of allocations made by a single component.
+    struct Section {
+        //! Section identifier.
+        const char* id { nullptr };
+
+        //! Number of bytes allocated in the section, including the block headers.
+        size_t size { 0 };
+
+        //! Number of allocations made in the section.
+        unsigned count { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p buf - memory region to allocate from.
+    //!  - @p size - size of @p buf, in bytes.
+    Arena(void* buf, size_t size);
+
+    //! Account all the following allocations to the section with @p id.
+    //!
+    //! @notes
+    //!  @p id should be valid during the arena lifetime.
+    void begin(const char* id);
+
+    //! Allocate @p size bytes aligned to @p alignment.
+    //!
+    //! @remarks
+    //!  The released blocks are reused first.
+    //!
+    //! @return
+    //!  Pointer to the allocated memory, or nullptr if the arena is exhausted.
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    //! Return the memory block to the arena.
+    //!
+    //! @notes
+    //!  Can be called by any task.
+    void release(void* ptr);
+
+    //! Return true if @p ptr was allocated from the arena.
+    bool contains(const void* ptr) const;
+
+    //! Return the total arena size, in bytes.
+    size_t get_size() const;
+
+    //! Return the number of bytes taken from the arena, including the released ones.
+    size_t get_used() const;
+
+    //! Return the number of bytes which were released since the arena creation.
+    size_t get_released() const;
+
+    //! Return the number of released bytes which aren't reused yet.
+    size_t get_free() const;
+
+    //! Return the number of sections.
+    unsigned get_section_count() const;
+
+    //! Return the section at @p index.
+    const Section& get_section(unsigned index) const;
+
+    //! Log the per-section usage report.
+    void report() const;
+
+private:
+    struct Header {
+        //! Block size, including the header and the alignment padding.
+        uint32_t size { 0 };
+
+        //! Offset of the header from the block beginning.
+        uint32_t offset { 0 };
+    };
+
+    struct FreeBlock {
+        FreeBlock* next { nullptr };
+        size_t size { 0 };
+    };
+
+    static constexpr size_t alignment_ = alignof(std::max_align_t);
+
+    static uint8_t* get_data_(uint8_t* block, size_t alignment);
+
+    void* reuse_(size_t size, size_t alignment);
+    void* place_(uint8_t* block, size_t block_size, size_t alignment);
+
+    uint8_t* const begin_ { nullptr };
+    uint8_t* const end_ { nullptr };
+
+    mutable StaticMutex mu_;
+
+    uint8_t* pos_ { nullptr };
+    FreeBlock* free_list_ { nullptr };
+
+    std::atomic<size_t> released_ { 0 };
+    std::atomic<size_t> free_ { 0 };
+
+    unsigned section_ { 0 };
+    unsigned section_count_ { 0 };
+    Section sections_[max_section_count];
+};
+
+} // namespace bonsai
+} // namespace ocs
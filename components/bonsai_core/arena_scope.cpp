@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <atomic>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "bonsai_core/arena_scope.h"
+#include "bonsai_core/boot_profiler.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+alignas(std::max_align_t) uint8_t arena_buffer[CONFIG_BONSAI_FIRMWARE_ARENA_SIZE];
+
+Arena& get_arena_instance() {
+    // Constructed on first use, since the allocations can happen before the
+    // static initialization of this translation unit.
+    static Arena arena(arena_buffer, sizeof(arena_buffer));
+    return arena;
+}
+
+std::atomic<TaskHandle_t> arena_owner { nullptr };
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+
+} // namespace
+
+Arena* ArenaScope::get_arena() {
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+    const TaskHandle_t owner = arena_owner;
+    if (owner && owner == xTaskGetCurrentTaskHandle()) {
+        return &get_arena_instance();
+    }
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+
+    return nullptr;
+}
+
+Arena* ArenaScope::get_static_arena() {
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+    return &get_arena_instance();
+#else
+    return nullptr;
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+}
+
+ArenaScope::ArenaScope() {
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+    TaskHandle_t expected = nullptr;
+    const bool activated =
+        arena_owner.compare_exchange_strong(expected, xTaskGetCurrentTaskHandle());
+    configASSERT(activated);
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+}
+
+ArenaScope::~ArenaScope() {
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+    arena_owner = nullptr;
+
+    get_arena_instance().report();
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+}
+
+void ArenaScope::begin(const char* id) {
+    BootProfiler::mark(id);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+    get_arena_instance().begin(id);
+#endif // CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_core/arena.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Redirect C++ heap allocations of the current task to the static arena.
+//!
+//! @remarks
+//!  While the scope is alive, each operator new called from the task which created
+//!  the scope is served by the static arena. Allocations made by other tasks, and
+//!  allocations made with malloc(), are not affected. If the arena is exhausted, the
+//!  per-section report is logged and the firmware is aborted, so the arena size is
+//!  checked on each boot. When the scope is destroyed, the per-section report is
+//!  logged, and the following allocations are served by the heap.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE is disabled, the scope does nothing.
+class ArenaScope : public core::NonCopyable<> {
+public:
+    //! Return the arena for the current task, if the scope is active.
+    static Arena* get_arena();
+
+    //! Return the static arena, or nullptr if the arena is disabled.
+    static Arena* get_static_arena();
+
+    //! Activate the scope for the current task.
+    ArenaScope();
+
+    //! Deactivate the scope and log the usage report.
+    ~ArenaScope();
+
+    //! Account all the following allocations to the component with @p id.
+    //!
+    //! @remarks
+    //!  @p id is also recorded as the boot stage, see BootProfiler.
+    void begin(const char* id);
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_core/boot_profiler.h"
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+struct Profile {
+    StaticMutex mu;
+    unsigned count { 0 };
+    BootProfiler::Stage stages[BootProfiler::max_stage_count];
+};
+
+Profile& get_profile() {
+    // Constructed on first use, since the stages can be recorded before the static
+    // initialization of this translation unit.
+    static Profile profile;
+    return profile;
+}
+
+bool is_recorded(const Profile& profile, const char* id) {
+    for (unsigned n = 0; n < profile.count; ++n) {
+        if (strcmp(profile.stages[n].id, id) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void record(Profile& profile, const char* id) {
+    if (profile.count == BootProfiler::max_stage_count) {
+        return;
+    }
+
+    profile.stages[profile.count].id = id;
+    profile.stages[profile.count].timestamp = esp_timer_get_time();
+    ++profile.count;
+}
+
+} // namespace
+
+void BootProfiler::mark(const char* id) {
+    Profile& profile = get_profile();
+    MutexLock lock(profile.mu);
+
+    record(profile, id);
+}
+
+void BootProfiler::mark_once(const char* id) {
+    Profile& profile = get_profile();
+    MutexLock lock(profile.mu);
+
+    if (!is_recorded(profile, id)) {
+        record(profile, id);
+    }
+}
+
+unsigned BootProfiler::get_count() {
+    Profile& profile = get_profile();
+    MutexLock lock(profile.mu);
+
+    return profile.count;
+}
+
+BootProfiler::Stage BootProfiler::get_stage(unsigned index) {
+    Profile& profile = get_profile();
+    MutexLock lock(profile.mu);
+
+    configASSERT(index < profile.count);
+    return profile.stages[index];
+}
+
+} // namespace bonsai
+} // namespace ocs
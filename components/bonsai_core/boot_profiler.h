@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Record the timestamps of the boot stages.
+//!
+//! @remarks
+//!  Each stage is recorded with the time elapsed since the chip reset, so the
+//!  stages recorded from different tasks can be compared with each other. Stages
+//!  recorded after the profile is full are dropped.
+class BootProfiler : public core::NonCopyable<> {
+public:
+    //! Maximum number of recorded stages.
+    static constexpr unsigned max_stage_count = 32;
+
+    //! Boot stage.
+    struct Stage {
+        //! Stage identifier.
+        const char* id { nullptr };
+
+        //! Time since the chip reset, in microseconds.
+        int64_t timestamp { 0 };
+    };
+
+    //! Record the stage with @p id.
+    //!
+    //! @notes
+    //!  @p id should be valid during the firmware lifetime.
+    static void mark(const char* id);
+
+    //! Record the stage with @p id, if it isn't recorded yet.
+    static void mark_once(const char* id);
+
+    //! Return the number of recorded stages.
+    static unsigned get_count();
+
+    //! Return the stage at @p index.
+    static Stage get_stage(unsigned index);
+};
+
+} // namespace bonsai
+} // namespace ocs
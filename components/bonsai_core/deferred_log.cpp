@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_timer.h"
+
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_core/seqlock.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+// Each slot is written by a single task at a time, unless the ring wraps around while
+// the message is being recorded, which requires the capacity to be unreasonably small.
+struct Ring {
+    std::atomic<uint32_t> count { 0 };
+    Seqlock<DeferredLog::Entry> entries[CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY];
+};
+
+Ring& get_ring() {
+    // Constructed on first use, since the messages can be logged before the static
+    // initialization of this translation unit.
+    static Ring ring;
+    return ring;
+}
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+
+// Reads the encoded arguments of the message.
+class Decoder {
+public:
+    explicit Decoder(const DeferredLog::Entry& entry)
+        : entry_(entry) {
+    }
+
+    bool read(void* data, size_t size) {
+        if (pos_ + size > entry_.size) {
+            return false;
+        }
+
+        memcpy(data, entry_.data + pos_, size);
+        pos_ += size;
+
+        return true;
+    }
+
+    bool read_int(size_t size, int64_t& value) {
+        if (size == sizeof(int32_t)) {
+            int32_t v = 0;
+            if (!read(&v, sizeof(v))) {
+                return false;
+            }
+
+            value = v;
+            return true;
+        }
+
+        return read(&value, sizeof(value));
+    }
+
+    bool read_string(char* buf, size_t size) {
+        uint8_t len = 0;
+        if (!read(&len, sizeof(len)) || len >= size) {
+            return false;
+        }
+
+        if (!read(buf, len)) {
+            return false;
+        }
+
+        buf[len] = '\0';
+        return true;
+    }
+
+private:
+    const DeferredLog::Entry& entry_;
+
+    size_t pos_ { 0 };
+};
+
+// Appends the formatted text to the fixed-size buffer.
+class Printer {
+public:
+    Printer(char* buf, size_t size)
+        : buf_(buf)
+        , size_(size) {
+        buf_[0] = '\0';
+    }
+
+    template <typename... Args> void print(const char* fmt, Args... args) {
+        if (pos_ + 1 >= size_) {
+            return;
+        }
+
+        const int ret = snprintf(buf_ + pos_, size_ - pos_, fmt, args...);
+        if (ret > 0) {
+            pos_ = std::min(size_ - 1, pos_ + ret);
+        }
+    }
+
+    void put(char c) {
+        if (pos_ + 1 < size_) {
+            buf_[pos_++] = c;
+            buf_[pos_] = '\0';
+        }
+    }
+
+private:
+    char* buf_ { nullptr };
+    const size_t size_ { 0 };
+
+    size_t pos_ { 0 };
+};
+
+size_t get_int_size(const char* length) {
+    if (strcmp(length, "ll") == 0 || strcmp(length, "j") == 0) {
+        return sizeof(long long);
+    }
+    if (strcmp(length, "l") == 0) {
+        return sizeof(long);
+    }
+    if (strcmp(length, "z") == 0) {
+        return sizeof(size_t);
+    }
+    if (strcmp(length, "t") == 0) {
+        return sizeof(ptrdiff_t);
+    }
+
+    return sizeof(int);
+}
+
+} // namespace
+
+unsigned DeferredLog::read(Entry* entries, unsigned max_count) {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+    Ring& ring = get_ring();
+
+    const uint32_t total = ring.count.load(std::memory_order_acquire);
+    const uint32_t count = std::min<uint32_t>(
+        std::min<uint32_t>(total, CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY),
+        max_count);
+
+    unsigned n = 0;
+
+    for (uint32_t seqnum = total - count + 1; seqnum <= total; ++seqnum) {
+        const Entry entry =
+            ring.entries[(seqnum - 1) % CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY]
+                .read();
+
+        // The message is still being written, or it's already overwritten.
+        if (entry.seqnum != seqnum) {
+            continue;
+        }
+
+        entries[n++] = entry;
+    }
+
+    return n;
+#else
+    (void)entries;
+    (void)max_count;
+
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+}
+
+uint32_t DeferredLog::get_overwrite_count() {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+    const uint32_t total = get_ring().count.load(std::memory_order_relaxed);
+
+    return total
+        - std::min<uint32_t>(total, CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY);
+#else
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+}
+
+void DeferredLog::format(const Entry& entry, char* buf, size_t size) {
+    Decoder decoder(entry);
+    Printer printer(buf, size);
+
+    const char* p = entry.fmt;
+
+    while (*p) {
+        if (*p != '%') {
+            printer.put(*p++);
+            continue;
+        }
+
+        ++p;
+
+        if (*p == '%') {
+            printer.put(*p++);
+            continue;
+        }
+
+        // Conversion specification without the length modifier.
+        char spec[24] = { '%' };
+        size_t spec_size = 1;
+
+        bool ok = true;
+
+        while (*p && strchr("-+ #0123456789.*", *p)) {
+            if (*p == '*') {
+                int64_t value = 0;
+                ok = ok && decoder.read_int(sizeof(int), value);
+
+                spec_size += snprintf(spec + spec_size, sizeof(spec) - spec_size, "%d",
+                                      static_cast<int>(value));
+            } else if (spec_size + 1 < sizeof(spec)) {
+                spec[spec_size++] = *p;
+            }
+
+            ++p;
+        }
+
+        char length[3] = {};
+        for (size_t n = 0; *p && strchr("hljztL", *p) && n + 1 < sizeof(length); ++n) {
+            length[n] = *p++;
+        }
+
+        const char conv = *p;
+        if (!conv || spec_size + 3 >= sizeof(spec)) {
+            break;
+        }
+
+        ++p;
+
+        if (strchr("diuxXoc", conv)) {
+            const size_t int_size = get_int_size(length);
+
+            int64_t value = 0;
+            ok = ok && decoder.read_int(int_size, value);
+
+            if (ok) {
+                if (int_size > sizeof(int32_t)) {
+                    spec[spec_size++] = 'l';
+                    spec[spec_size++] = 'l';
+                    spec[spec_size] = conv;
+
+                    printer.print(spec, static_cast<long long>(value));
+                } else {
+                    spec[spec_size] = conv;
+
+                    printer.print(spec, static_cast<int>(value));
+                }
+            }
+        } else if (strchr("fFeEgGaA", conv)) {
+            double value = 0;
+            ok = ok && decoder.read(&value, sizeof(value));
+
+            if (ok) {
+                spec[spec_size] = conv;
+                printer.print(spec, value);
+            }
+        } else if (conv == 's') {
+            char str[max_data_size];
+            ok = ok && decoder.read_string(str, sizeof(str));
+
+            if (ok) {
+                spec[spec_size] = conv;
+                printer.print(spec, str);
+            }
+        } else if (conv == 'p') {
+            uintptr_t value = 0;
+            ok = ok && decoder.read(&value, sizeof(value));
+
+            if (ok) {
+                printer.print("%p", reinterpret_cast<void*>(value));
+            }
+        }
+
+        if (!ok) {
+            break;
+        }
+    }
+
+    if (*p || entry.truncated) {
+        printer.print("...");
+    }
+}
+
+void DeferredLog::encode_arg_(Entry& entry, int arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, unsigned arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, long arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, unsigned long arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, long long arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, unsigned long long arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, double arg) {
+    append_(entry, &arg, sizeof(arg));
+}
+
+void DeferredLog::encode_arg_(Entry& entry, const char* arg) {
+    if (!arg) {
+        arg = "(null)";
+    }
+
+    const uint8_t len = std::min<size_t>(strlen(arg), max_data_size - 1);
+    if (entry.truncated || entry.size + sizeof(len) + len > max_data_size) {
+        entry.truncated = true;
+        return;
+    }
+
+    append_(entry, &len, sizeof(len));
+    append_(entry, arg, len);
+}
+
+void DeferredLog::encode_arg_(Entry& entry, const void* arg) {
+    const uintptr_t value = reinterpret_cast<uintptr_t>(arg);
+    append_(entry, &value, sizeof(value));
+}
+
+void DeferredLog::append_(Entry& entry, const void* data, size_t size) {
+    if (entry.truncated || entry.size + size > max_data_size) {
+        entry.truncated = true;
+        return;
+    }
+
+    memcpy(entry.data + entry.size, data, size);
+    entry.size += size;
+}
+
+void DeferredLog::record_(Entry& entry) {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+    entry.timestamp = esp_timer_get_time();
+
+    Ring& ring = get_ring();
+
+    const uint32_t seqnum = ring.count.fetch_add(1, std::memory_order_relaxed) + 1;
+    entry.seqnum = seqnum;
+
+    ring.entries[(seqnum - 1) % CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY].write(
+        entry);
+#else
+    (void)entry;
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/log.h"
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Log message severity.
+enum class LogLevel : uint8_t {
+    Error,
+    Warning,
+    Info,
+};
+
+//! Record the log messages into the fixed-size ring without formatting them.
+//!
+//! @remarks
+//!  Only the format string pointer and the raw arguments are stored, the message is
+//!  formatted when the log is read. String arguments are copied, since they may not
+//!  outlive the call. Writers don't block each other and never block on the reader.
+//!  The oldest messages are overwritten when the ring is full.
+//!
+//!  Use bonsai_loge(), bonsai_logw() and bonsai_logi() instead of calling write()
+//!  directly. If CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE is disabled, they are
+//!  forwarded to ocs_loge(), ocs_logw() and ocs_logi().
+class DeferredLog : public core::NonCopyable<> {
+public:
+    //! Maximum size of the encoded arguments of the single message, in bytes.
+    static constexpr size_t max_data_size = 40;
+
+    //! Recorded message.
+    struct Entry {
+        //! Sequence number of the message, starting from 1.
+        uint32_t seqnum { 0 };
+
+        //! Time since the chip reset, in microseconds.
+        int64_t timestamp { 0 };
+
+        //! Message tag.
+        const char* tag { nullptr };
+
+        //! Format string.
+        const char* fmt { nullptr };
+
+        //! Message severity.
+        LogLevel level { LogLevel::Info };
+
+        //! True if some arguments didn't fit into the message.
+        bool truncated { false };
+
+        //! Size of the encoded arguments.
+        uint8_t size { 0 };
+
+        //! Encoded arguments.
+        uint8_t data[max_data_size];
+    };
+
+    //! Record the message.
+    //!
+    //! @notes
+    //!  @p tag and @p fmt should be valid during the firmware lifetime.
+    template <typename... Args>
+    static void write(LogLevel level, const char* tag, const char* fmt, Args... args) {
+        Entry entry;
+        entry.level = level;
+        entry.tag = tag;
+        entry.fmt = fmt;
+
+        encode_(entry, args...);
+        record_(entry);
+    }
+
+    //! Copy up to @p max_count recorded messages to @p entries, oldest first.
+    //!
+    //! @return
+    //!  Number of copied messages.
+    static unsigned read(Entry* entries, unsigned max_count);
+
+    //! Return the number of overwritten messages.
+    static uint32_t get_overwrite_count();
+
+    //! Format the message of @p entry into @p buf of @p size bytes.
+    //!
+    //! @remarks
+    //!  Supports the d, i, u, x, X, o, c, p, s, f, e, g conversions with the optional
+    //!  flags, width, precision and length modifiers.
+    static void format(const Entry& entry, char* buf, size_t size);
+
+private:
+    static void encode_(Entry&) {
+    }
+
+    template <typename T, typename... Args>
+    static void encode_(Entry& entry, T arg, Args... args) {
+        encode_arg_(entry, arg);
+        encode_(entry, args...);
+    }
+
+    static void encode_arg_(Entry& entry, int arg);
+    static void encode_arg_(Entry& entry, unsigned arg);
+    static void encode_arg_(Entry& entry, long arg);
+    static void encode_arg_(Entry& entry, unsigned long arg);
+    static void encode_arg_(Entry& entry, long long arg);
+    static void encode_arg_(Entry& entry, unsigned long long arg);
+    static void encode_arg_(Entry& entry, double arg);
+    static void encode_arg_(Entry& entry, const char* arg);
+    static void encode_arg_(Entry& entry, const void* arg);
+
+    static void append_(Entry& entry, const void* data, size_t size);
+
+    static void record_(Entry& entry);
+};
+
+} // namespace bonsai
+} // namespace ocs
+
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+// The dead call keeps the compile-time format checks of the regular log.
+#define BONSAI_DEFERRED_LOG(level, log, tag, fmt, ...)                                   \
+    do {                                                                                 \
+        if (false) {                                                                     \
+            log(tag, fmt, ##__VA_ARGS__);                                                \
+        }                                                                                \
+        ocs::bonsai::DeferredLog::write(level, tag, fmt, ##__VA_ARGS__);                 \
+    } while (false)
+
+#define bonsai_loge(tag, fmt, ...)                                                       \
+    BONSAI_DEFERRED_LOG(ocs::bonsai::LogLevel::Error, ocs_loge, tag, fmt, ##__VA_ARGS__)
+
+#define bonsai_logw(tag, fmt, ...)                                                       \
+    BONSAI_DEFERRED_LOG(ocs::bonsai::LogLevel::Warning, ocs_logw, tag, fmt,              \
+                        ##__VA_ARGS__)
+
+#define bonsai_logi(tag, fmt, ...)                                                       \
+    BONSAI_DEFERRED_LOG(ocs::bonsai::LogLevel::Info, ocs_logi, tag, fmt, ##__VA_ARGS__)
+#else
+#define bonsai_loge(tag, fmt, ...) ocs_loge(tag, fmt, ##__VA_ARGS__)
+#define bonsai_logw(tag, fmt, ...) ocs_logw(tag, fmt, ##__VA_ARGS__)
+#define bonsai_logi(tag, fmt, ...) ocs_logi(tag, fmt, ##__VA_ARGS__)
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/oneshot_task.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "oneshot_task";
+
+} // namespace
+
+OneshotTask::OneshotTask(scheduler::ITask& task, const char* id, Params params)
+    : params_(params)
+    , id_(id)
+    , task_(task) {
+    configASSERT(params_.stack_size);
+}
+
+status::StatusCode OneshotTask::start() {
+    configASSERT(!handle_);
+
+    if (xTaskCreate(run_, id_, params_.stack_size, this, params_.priority, &handle_)
+        != pdPASS) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+void OneshotTask::run_(void* arg) {
+    OneshotTask& self = *static_cast<OneshotTask*>(arg);
+
+    const auto code = self.task_.run();
+    if (code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "task failed: id=%s code=%s", self.id_,
+                 status::code_to_str(code));
+    }
+
+    vTaskDelete(nullptr);
+}
+
+} // namespace bonsai
+} // namespace ocs
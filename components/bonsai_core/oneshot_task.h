@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Run the task once, in the dedicated FreeRTOS task.
+//!
+//! @remarks
+//!  The FreeRTOS task is deleted as soon as the underlying task returns.
+class OneshotTask : public core::NonCopyable<> {
+public:
+    struct Params {
+        //! FreeRTOS task stack size, in bytes.
+        unsigned stack_size { 0 };
+
+        //! FreeRTOS task priority.
+        UBaseType_t priority { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p task to run.
+    //!  - @p id - FreeRTOS task name.
+    OneshotTask(scheduler::ITask& task, const char* id, Params params);
+
+    //! Start the FreeRTOS task.
+    //!
+    //! @notes
+    //!  Can be called only once.
+    status::StatusCode start();
+
+private:
+    static void run_(void* arg);
+
+    const Params params_;
+    const char* id_ { nullptr };
+
+    scheduler::ITask& task_;
+
+    TaskHandle_t handle_ { nullptr };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "bonsai_core/alloc_tracker.h"
+#include "bonsai_core/arena_scope.h"
+
+#if defined(CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE)                                         \
+    || defined(CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE)
+
+namespace {
+
+void* heap_allocate(size_t size, size_t alignment) {
+    if (!size) {
+        size = 1;
+    }
+
+    if (alignment <= alignof(std::max_align_t)) {
+        return malloc(size);
+    }
+
+    return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+}
+
+void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    ocs::bonsai::AllocTracker::record(ocs::bonsai::AllocTracker::get_domain(), size);
+
+    if (ocs::bonsai::Arena* arena = ocs::bonsai::ArenaScope::get_arena()) {
+        void* ptr = arena->allocate(size, alignment);
+        if (!ptr) {
+            // The arena is sized for the pipeline construction, so the exhaustion is
+            // a configuration error, it should be found on the first boot.
+            arena->report();
+            abort();
+        }
+
+        return ptr;
+    }
+
+    return heap_allocate(size, alignment);
+}
+
+void* allocate_or_abort(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    void* ptr = allocate(size, alignment);
+    if (!ptr) {
+        abort();
+    }
+
+    return ptr;
+}
+
+void release(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    // Blocks allocated with the aligned_alloc() are released with free() as well.
+    ocs::bonsai::Arena* arena = ocs::bonsai::ArenaScope::get_static_arena();
+    if (arena && arena->contains(ptr)) {
+        arena->release(ptr);
+    } else {
+        free(ptr);
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    return allocate_or_abort(size);
+}
+
+void* operator new[](size_t size) {
+    return allocate_or_abort(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate_or_abort(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocate_or_abort(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size,
+                   std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    release(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    release(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    release(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+    release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(ptr);
+}
+
+#endif // defined(CONFIG_BONSAI_FIRMWARE_ARENA_ENABLE) ||
+       // defined(CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE)
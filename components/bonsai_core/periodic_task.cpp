@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/periodic_task.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "periodic_task";
+
+} // namespace
+
+PeriodicTask::PeriodicTask(scheduler::ITask& task, const char* id, Params params)
+    : params_(params)
+    , id_(id)
+    , task_(task) {
+    configASSERT(params_.interval >= core::Duration::millisecond);
+    configASSERT(params_.stack_size);
+}
+
+PeriodicTask::~PeriodicTask() {
+    if (handle_) {
+        vTaskDelete(handle_);
+    }
+}
+
+status::StatusCode PeriodicTask::start() {
+    configASSERT(!handle_);
+
+    if (xTaskCreate(run_, id_, params_.stack_size, this, params_.priority, &handle_)
+        != pdPASS) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+void PeriodicTask::run_(void* arg) {
+    PeriodicTask& self = *static_cast<PeriodicTask*>(arg);
+
+    const TickType_t interval =
+        pdMS_TO_TICKS(self.params_.interval / core::Duration::millisecond);
+
+    TickType_t wake_time = xTaskGetTickCount();
+
+    while (true) {
+        const auto code = self.task_.run();
+        if (code != status::StatusCode::OK) {
+            ocs_logw(log_tag, "task failed: id=%s code=%s", self.id_,
+                     status::code_to_str(code));
+        }
+
+        xTaskDelayUntil(&wake_time, interval);
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Run the task periodically, in the dedicated FreeRTOS task.
+//!
+//! @remarks
+//!  Unlike the shared task scheduler, the task has its own priority, so the slow
+//!  low-priority work doesn't delay the other scheduled tasks.
+class PeriodicTask : public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Interval between the runs.
+        core::Time interval { 0 };
+
+        //! FreeRTOS task stack size, in bytes.
+        unsigned stack_size { 0 };
+
+        //! FreeRTOS task priority.
+        UBaseType_t priority { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p task to run.
+    //!  - @p id - FreeRTOS task name.
+    PeriodicTask(scheduler::ITask& task, const char* id, Params params);
+
+    //! Delete the FreeRTOS task.
+    ~PeriodicTask();
+
+    //! Start the FreeRTOS task.
+    //!
+    //! @notes
+    //!  Can be called only once.
+    status::StatusCode start();
+
+private:
+    static void run_(void* arg);
+
+    const Params params_;
+    const char* id_ { nullptr };
+
+    scheduler::ITask& task_;
+
+    TaskHandle_t handle_ { nullptr };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Lock-free snapshot of the value, written by a single task and read by many.
+//!
+//! @remarks
+//!  The writer never blocks. The reader retries the copy if a write happened in the
+//!  meantime, so it never observes a partially updated value. If the writer was
+//!  preempted in the middle of the update, the reader sleeps for a tick to let it
+//!  complete, even if the writer has a lower priority.
+template <typename T> class Seqlock : public core::NonCopyable<> {
+public:
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "seqlock value should be trivially copyable");
+
+    //! Initialize with the default value.
+    Seqlock() {
+        memset(static_cast<void*>(&value_), 0, sizeof(value_));
+    }
+
+    //! Publish @p value.
+    //!
+    //! @notes
+    //!  Should be called from a single task.
+    void write(const T& value) {
+        const uint32_t seq = seq_.load(std::memory_order_relaxed);
+
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&value_, &value, sizeof(value_));
+
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    //! Return the last published value.
+    T read() const {
+        T value;
+        read(value);
+
+        return value;
+    }
+
+    //! Copy the last published value to @p value.
+    //!
+    //! @remarks
+    //!  Avoids the temporary copy on the stack for the large values.
+    void read(T& value) const {
+        while (true) {
+            const uint32_t begin = seq_.load(std::memory_order_acquire);
+            if (begin & 1) {
+                vTaskDelay(1);
+                continue;
+            }
+
+            memcpy(&value, &value_, sizeof(value));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (seq_.load(std::memory_order_relaxed) == begin) {
+                return;
+            }
+        }
+    }
+
+    //! Return the number of published values.
+    uint32_t get_version() const {
+        return seq_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    std::atomic<uint32_t> seq_ { 0 };
+    T value_;
+};
+
+} // namespace bonsai
+} // namespace ocs
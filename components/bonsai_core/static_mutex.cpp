@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+StaticMutex::StaticMutex() {
+    sem_ = xSemaphoreCreateMutexStatic(&sem_buf_);
+    configASSERT(sem_);
+}
+
+void StaticMutex::lock() {
+    xSemaphoreTake(sem_, portMAX_DELAY);
+}
+
+void StaticMutex::unlock() {
+    xSemaphoreGive(sem_);
+}
+
+MutexLock::MutexLock(StaticMutex& mutex)
+    : mutex_(mutex) {
+    mutex_.lock();
+}
+
+MutexLock::~MutexLock() {
+    mutex_.unlock();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! FreeRTOS mutex with the statically allocated control block.
+class StaticMutex : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    StaticMutex();
+
+    //! Lock the mutex, wait as long as needed.
+    void lock();
+
+    //! Unlock the mutex.
+    void unlock();
+
+private:
+    StaticSemaphore_t sem_buf_;
+    SemaphoreHandle_t sem_ { nullptr };
+};
+
+//! Lock the mutex for the scope lifetime.
+class MutexLock : public core::NonCopyable<> {
+public:
+    //! Lock @p mutex.
+    explicit MutexLock(StaticMutex& mutex);
+
+    //! Unlock the mutex.
+    ~MutexLock();
+
+private:
+    StaticMutex& mutex_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_core/tracer.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+struct Trace {
+    StaticMutex mu;
+
+    uint32_t total_count { 0 };
+    Tracer::Event events[CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY];
+
+    unsigned task_count { 0 };
+    char task_names[Tracer::max_task_count][configMAX_TASK_NAME_LEN];
+};
+
+Trace& get_trace() {
+    // Constructed on first use, since the events can be recorded before the static
+    // initialization of this translation unit.
+    static Trace trace;
+    return trace;
+}
+
+// Index of the current task in the task table, resolved on the first event.
+thread_local int current_task = -1;
+
+uint8_t get_task(Trace& trace) {
+    if (current_task < 0) {
+        if (trace.task_count == Tracer::max_task_count) {
+            current_task = Tracer::unknown_task;
+        } else {
+            strncpy(trace.task_names[trace.task_count], pcTaskGetName(nullptr),
+                    configMAX_TASK_NAME_LEN - 1);
+            current_task = trace.task_count;
+            ++trace.task_count;
+        }
+    }
+
+    return current_task;
+}
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+
+} // namespace
+
+void Tracer::record(TracePhase phase, const char* category, const char* name) {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    const int64_t now = esp_timer_get_time();
+
+    Trace& trace = get_trace();
+    MutexLock lock(trace.mu);
+
+    Event& event =
+        trace.events[trace.total_count % CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY];
+    event.timestamp = now;
+    event.category = category;
+    event.name = name;
+    event.task = get_task(trace);
+    event.phase = phase;
+
+    ++trace.total_count;
+#else
+    (void)phase;
+    (void)category;
+    (void)name;
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+unsigned Tracer::read(Event* events, unsigned max_count) {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    Trace& trace = get_trace();
+    MutexLock lock(trace.mu);
+
+    const uint32_t count = std::min<uint32_t>(
+        std::min<uint32_t>(trace.total_count, CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY),
+        max_count);
+
+    const uint32_t begin = trace.total_count - count;
+
+    for (uint32_t n = 0; n < count; ++n) {
+        events[n] = trace.events[(begin + n) % CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY];
+    }
+
+    return count;
+#else
+    (void)events;
+    (void)max_count;
+
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+uint32_t Tracer::get_overwrite_count() {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    Trace& trace = get_trace();
+    MutexLock lock(trace.mu);
+
+    return trace.total_count
+        - std::min<uint32_t>(trace.total_count, CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY);
+#else
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+unsigned Tracer::get_task_count() {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    Trace& trace = get_trace();
+    MutexLock lock(trace.mu);
+
+    return trace.task_count;
+#else
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+void Tracer::get_task_name(unsigned index, char* buf, size_t size) {
+    configASSERT(size);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    Trace& trace = get_trace();
+    MutexLock lock(trace.mu);
+
+    configASSERT(index < trace.task_count);
+
+    strncpy(buf, trace.task_names[index], size - 1);
+    buf[size - 1] = '\0';
+#else
+    (void)index;
+
+    buf[0] = '\0';
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+TraceScope::TraceScope(const char* category, const char* name)
+    : category_(category)
+    , name_(name) {
+    Tracer::record(TracePhase::Begin, category_, name_);
+}
+
+TraceScope::~TraceScope() {
+    Tracer::record(TracePhase::End, category_, name_);
+}
+
+} // namespace bonsai
+} // namespace ocs
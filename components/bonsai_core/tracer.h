@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Type of the trace event.
+enum class TracePhase : uint8_t {
+    //! Beginning of the activity.
+    Begin,
+
+    //! End of the activity started by the last Begin event of the same task.
+    End,
+
+    //! Single point in time.
+    Instant,
+};
+
+//! Record the timeline of the firmware activity into the fixed-size ring.
+//!
+//! @remarks
+//!  Each event is recorded with the time since the chip reset and the task which
+//!  recorded it. The category and the name are stored as pointers, the strings are
+//!  resolved only when the trace is read. The oldest events are overwritten when
+//!  the ring is full.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE is disabled, nothing is recorded.
+class Tracer : public core::NonCopyable<> {
+public:
+    //! Maximum number of tasks with the known names.
+    static constexpr unsigned max_task_count = 16;
+
+    //! Task index of the events recorded after the task table is full.
+    static constexpr uint8_t unknown_task = UINT8_MAX;
+
+    //! Trace event.
+    struct Event {
+        //! Time since the chip reset, in microseconds.
+        int64_t timestamp { 0 };
+
+        //! Activity category, e.g. "http" or "sensor".
+        const char* category { nullptr };
+
+        //! Activity name, e.g. the HTTP path or the sensor identifier.
+        const char* name { nullptr };
+
+        //! Index of the task which recorded the event, see get_task_name().
+        uint8_t task { unknown_task };
+
+        //! Event type.
+        TracePhase phase { TracePhase::Instant };
+    };
+
+    //! Record the event.
+    //!
+    //! @notes
+    //!  @p category and @p name should be valid during the firmware lifetime.
+    static void record(TracePhase phase, const char* category, const char* name);
+
+    //! Copy up to @p max_count recorded events to @p events, oldest first.
+    //!
+    //! @return
+    //!  Number of copied events.
+    static unsigned read(Event* events, unsigned max_count);
+
+    //! Return the number of overwritten events.
+    static uint32_t get_overwrite_count();
+
+    //! Return the number of known tasks.
+    static unsigned get_task_count();
+
+    //! Copy the name of the task at @p index to @p buf of @p size bytes.
+    static void get_task_name(unsigned index, char* buf, size_t size);
+};
+
+//! Record the Begin and End events for the scope lifetime.
+class TraceScope : public core::NonCopyable<> {
+public:
+    //! Record the Begin event.
+    TraceScope(const char* category, const char* name);
+
+    //! Record the End event.
+    ~TraceScope();
+
+private:
+    const char* category_ { nullptr };
+    const char* name_ { nullptr };
+};
+
+} // namespace bonsai
+} // namespace ocs
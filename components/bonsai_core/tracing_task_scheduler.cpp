@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "bonsai_core/tracer.h"
+#include "bonsai_core/tracing_task_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+TracingTaskScheduler::TracingTask::TracingTask(scheduler::ITask& task, const char* id)
+    : task_(task)
+    , id_(id) {
+}
+
+status::StatusCode TracingTaskScheduler::TracingTask::run() {
+    TraceScope trace_scope("task", id_);
+
+    return task_.run();
+}
+
+TracingTaskScheduler::TracingTaskScheduler(scheduler::ITaskScheduler& task_scheduler)
+    : task_scheduler_(task_scheduler) {
+}
+
+status::StatusCode
+TracingTaskScheduler::add(scheduler::ITask& task, const char* id, core::Time interval) {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    std::unique_ptr<TracingTask> tracing_task(new (std::nothrow) TracingTask(task, id));
+    if (!tracing_task) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = task_scheduler_.add(*tracing_task, id, interval);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    tasks_.push_back(std::move(tracing_task));
+
+    return status::StatusCode::OK;
+#else
+    return task_scheduler_.add(task, id, interval);
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_scheduler/itask_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Register the tasks in the underlying scheduler, recording each run by the tracer.
+//!
+//! @remarks
+//!  Each run is recorded in the "task" category, named by the task identifier. The
+//!  pipelines are created with this scheduler instead of the system one. The sensor
+//!  reads are additionally recorded in the "sensor" category, see SensorTaskScheduler,
+//!  so they're nested in the task events.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE is disabled, the tasks are registered as is.
+class TracingTaskScheduler : public scheduler::ITaskScheduler,
+                             public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit TracingTaskScheduler(scheduler::ITaskScheduler& task_scheduler);
+
+    //! Register @p task in the underlying scheduler.
+    //!
+    //! @notes
+    //!  @p id should be valid during the firmware lifetime.
+    status::StatusCode
+    add(scheduler::ITask& task, const char* id, core::Time interval) override;
+
+private:
+    class TracingTask : public scheduler::ITask, public core::NonCopyable<> {
+    public:
+        TracingTask(scheduler::ITask& task, const char* id);
+
+        status::StatusCode run() override;
+
+    private:
+        scheduler::ITask& task_;
+        const char* id_ { nullptr };
+    };
+
+    scheduler::ITaskScheduler& task_scheduler_;
+
+    std::vector<std::unique_ptr<TracingTask>> tasks_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_deadband/deadband_config.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "deadband_config";
+
+bool format_policy(cJSON* json, const char* key, const DeadbandConfig::Policy& policy) {
+    cJSON* item = cJSON_AddObjectToObject(json, key);
+    if (!item) {
+        return false;
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(item);
+
+    return formatter.add_number_cs("absolute", policy.absolute)
+        && formatter.add_number_cs("relative", policy.relative)
+        && formatter.add_number_cs("heartbeat", policy.heartbeat);
+}
+
+} // namespace
+
+DeadbandConfig::DeadbandConfig(storage::IStorage& storage,
+                               Policy default_policy,
+                               unsigned max_policy_count)
+    : max_policy_count_(max_policy_count)
+    , storage_(storage)
+    , default_policy_(default_policy) {
+    entries_.reset(new (std::nothrow) Entry[max_policy_count_]);
+    configASSERT(entries_);
+
+    load_();
+}
+
+DeadbandConfig::Policy DeadbandConfig::get_default() const {
+    MutexLock lock(mu_);
+    return default_policy_;
+}
+
+DeadbandConfig::Policy DeadbandConfig::get(const char* field) const {
+    MutexLock lock(mu_);
+
+    const int index = find_(field);
+    if (index < 0) {
+        return default_policy_;
+    }
+
+    return entries_[index].policy;
+}
+
+status::StatusCode DeadbandConfig::set(const char* field, Policy policy) {
+    MutexLock lock(mu_);
+
+    if (!field) {
+        const auto code = storage_.write(default_key_, &policy, sizeof(policy));
+        if (code == status::StatusCode::OK) {
+            default_policy_ = policy;
+        }
+
+        return code;
+    }
+
+    if (!*field || strlen(field) > max_field_len) {
+        return status::StatusCode::InvalidArg;
+    }
+
+    int index = find_(field);
+    if (index < 0) {
+        if (entry_count_ == max_policy_count_) {
+            return status::StatusCode::NoMem;
+        }
+
+        index = entry_count_;
+
+        memset(entries_[index].field, 0, sizeof(entries_[index].field));
+        strcpy(entries_[index].field, field);
+    }
+
+    const Policy prev_policy = entries_[index].policy;
+    entries_[index].policy = policy;
+
+    const unsigned entry_count = static_cast<unsigned>(index) == entry_count_
+        ? entry_count_ + 1
+        : entry_count_;
+
+    const auto code =
+        storage_.write(fields_key_, entries_.get(), entry_count * sizeof(Entry));
+    if (code != status::StatusCode::OK) {
+        entries_[index].policy = prev_policy;
+        return code;
+    }
+
+    entry_count_ = entry_count;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeadbandConfig::reset(const char* field) {
+    MutexLock lock(mu_);
+
+    const int index = find_(field);
+    if (index < 0) {
+        return status::StatusCode::OK;
+    }
+
+    const Entry removed = entries_[index];
+
+    for (unsigned n = index; n + 1 < entry_count_; ++n) {
+        entries_[n] = entries_[n + 1];
+    }
+
+    --entry_count_;
+
+    const auto code = entry_count_
+        ? storage_.write(fields_key_, entries_.get(), entry_count_ * sizeof(Entry))
+        : storage_.erase(fields_key_);
+
+    if (code != status::StatusCode::OK) {
+        for (unsigned n = entry_count_; n > static_cast<unsigned>(index); --n) {
+            entries_[n] = entries_[n - 1];
+        }
+
+        entries_[index] = removed;
+        ++entry_count_;
+    }
+
+    return code;
+}
+
+status::StatusCode DeadbandConfig::format(cJSON* json) {
+    MutexLock lock(mu_);
+
+    if (!format_policy(json, "default", default_policy_)) {
+        return status::StatusCode::NoMem;
+    }
+
+    cJSON* fields = cJSON_AddObjectToObject(json, "fields");
+    if (!fields) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (unsigned n = 0; n < entry_count_; ++n) {
+        if (!format_policy(fields, entries_[n].field, entries_[n].policy)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+void DeadbandConfig::load_() {
+    Policy policy;
+
+    auto code = storage_.read(default_key_, &policy, sizeof(policy));
+    if (code == status::StatusCode::OK) {
+        default_policy_ = policy;
+    } else if (code != status::StatusCode::NoData) {
+        ocs_logw(log_tag, "failed to read default policy: %s",
+                 status::code_to_str(code));
+    }
+
+    unsigned size = 0;
+
+    code = storage_.probe(fields_key_, size);
+    if (code != status::StatusCode::OK) {
+        if (code != status::StatusCode::NoData) {
+            ocs_logw(log_tag, "failed to probe policies: %s", status::code_to_str(code));
+        }
+
+        return;
+    }
+
+    if (size % sizeof(Entry) || size / sizeof(Entry) > max_policy_count_) {
+        ocs_logw(log_tag, "ignore policies: size=%u", size);
+        return;
+    }
+
+    code = storage_.read(fields_key_, entries_.get(), size);
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to read policies: %s", status::code_to_str(code));
+        return;
+    }
+
+    entry_count_ = size / sizeof(Entry);
+
+    for (unsigned n = 0; n < entry_count_; ++n) {
+        entries_[n].field[max_field_len] = '\0';
+    }
+}
+
+int DeadbandConfig::find_(const char* field) const {
+    for (unsigned n = 0; n < entry_count_; ++n) {
+        if (strcmp(entries_[n].field, field) == 0) {
+            return n;
+        }
+    }
+
+    return -1;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_status/code.h"
+#include "ocs_storage/istorage.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Deadband policies of the telemetry fields, persisted in the storage.
+//!
+//! @remarks
+//!  The fields without their own policy use the default policy.
+class DeadbandConfig : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Maximum length of the field name.
+    static constexpr unsigned max_field_len = 31;
+
+    struct Policy {
+        //! Minimum absolute change of the value to be reported, 0 to disable.
+        float absolute;
+
+        //! Minimum change relative to the last reported value, in percents,
+        //! 0 to disable.
+        float relative;
+
+        //! Maximum interval between the reports, in seconds, 0 to disable.
+        uint32_t heartbeat;
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p storage to persist the policies.
+    //!  - @p default_policy - policy used until the default policy is configured.
+    //!  - @p max_policy_count - maximum number of the per-field policies.
+    DeadbandConfig(storage::IStorage& storage,
+                   Policy default_policy,
+                   unsigned max_policy_count);
+
+    //! Return the default policy.
+    Policy get_default() const;
+
+    //! Return the policy of @p field.
+    Policy get(const char* field) const;
+
+    //! Set the policy of @p field, or the default policy if @p field is nullptr.
+    status::StatusCode set(const char* field, Policy policy);
+
+    //! Remove the policy of @p field, the default policy is used instead.
+    status::StatusCode reset(const char* field);
+
+    //! Format all the policies.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    struct Entry {
+        char field[max_field_len + 1];
+        Policy policy;
+    };
+
+    static constexpr const char* default_key_ = "default";
+    static constexpr const char* fields_key_ = "fields";
+
+    void load_();
+    int find_(const char* field) const;
+
+    const unsigned max_policy_count_ { 0 };
+
+    storage::IStorage& storage_;
+
+    mutable StaticMutex mu_;
+
+    Policy default_policy_;
+
+    std::unique_ptr<Entry[]> entries_;
+    unsigned entry_count_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
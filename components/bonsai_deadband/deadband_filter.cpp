@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_deadband/deadband_filter.h"
+
+namespace ocs {
+namespace bonsai {
+
+DeadbandFilter::DeadbandFilter(core::IClock& clock,
+                               DeadbandConfig& config,
+                               unsigned max_field_count)
+    : max_field_count_(max_field_count)
+    , clock_(clock)
+    , config_(config) {
+    fields_.reset(new (std::nothrow) Field[max_field_count_]);
+    configASSERT(fields_);
+}
+
+unsigned DeadbandFilter::apply(cJSON* json) {
+    const core::Time now = clock_.now();
+
+    unsigned count = 0;
+
+    cJSON* item = json ? json->child : nullptr;
+
+    while (item) {
+        cJSON* next = item->next;
+
+        if (cJSON_IsNumber(item) || cJSON_IsBool(item)) {
+            const float value =
+                cJSON_IsBool(item) ? cJSON_IsTrue(item) : item->valuedouble;
+
+            Field* field = find_(item->string);
+
+            if (!field) {
+                ++count;
+            } else if (field->timestamp < 0 || report_(*field, value, now)) {
+                field->value = value;
+                field->timestamp = now;
+
+                ++count;
+            } else {
+                cJSON_Delete(cJSON_DetachItemViaPointer(json, item));
+            }
+        }
+
+        item = next;
+    }
+
+    return count;
+}
+
+DeadbandFilter::Field* DeadbandFilter::find_(const char* key) {
+    for (unsigned n = 0; n < field_count_; ++n) {
+        if (strcmp(fields_[n].key, key) == 0) {
+            return &fields_[n];
+        }
+    }
+
+    if (field_count_ == max_field_count_ || strlen(key) > DeadbandConfig::max_field_len) {
+        return nullptr;
+    }
+
+    Field& field = fields_[field_count_++];
+
+    strcpy(field.key, key);
+    field.timestamp = -1;
+
+    return &field;
+}
+
+bool DeadbandFilter::report_(const Field& field, float value, core::Time now) const {
+    const auto policy = config_.get(field.key);
+
+    if (policy.absolute <= 0 && policy.relative <= 0) {
+        return true;
+    }
+
+    if (policy.heartbeat
+        && now - field.timestamp >= core::Duration::second * policy.heartbeat) {
+        return true;
+    }
+
+    const float delta = std::fabs(value - field.value);
+
+    if (policy.absolute > 0 && delta > policy.absolute) {
+        return true;
+    }
+
+    if (policy.relative > 0 && delta > std::fabs(field.value) * policy.relative / 100) {
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace bonsai
+} // namespace ocs
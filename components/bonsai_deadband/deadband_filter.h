@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "cJSON.h"
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+
+#include "bonsai_deadband/deadband_config.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Report the telemetry fields by exception.
+//!
+//! @remarks
+//!  A numeric or boolean field is reported if its value moved beyond the deadband
+//!  of its policy since the last report, or if the heartbeat interval elapsed.
+//!  Each output has its own filter, since it tracks the last reported values.
+//!  The filter isn't thread-safe.
+class DeadbandFilter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p max_field_count - maximum number of the tracked fields, the fields above
+    //!    the limit are always reported.
+    DeadbandFilter(core::IClock& clock, DeadbandConfig& config, unsigned max_field_count);
+
+    //! Remove the fields, which shouldn't be reported, from @p json.
+    //!
+    //! @return
+    //!  Number of the numeric and boolean fields left in @p json.
+    unsigned apply(cJSON* json);
+
+private:
+    struct Field {
+        char key[DeadbandConfig::max_field_len + 1];
+        float value { 0 };
+        core::Time timestamp { 0 };
+    };
+
+    Field* find_(const char* key);
+    bool report_(const Field& field, float value, core::Time now) const;
+
+    const unsigned max_field_count_ { 0 };
+
+    core::IClock& clock_;
+    DeadbandConfig& config_;
+
+    std::unique_ptr<Field[]> fields_;
+    unsigned field_count_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_deadband/deadband_handler.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+// Maximum query length, enough for the field name and all the policy parameters.
+const size_t max_query_len = 128;
+
+bool parse_float(const char* str, float& value) {
+    char* end = nullptr;
+
+    const float ret = strtof(str, &end);
+    if (end == str || *end != '\0' || ret < 0) {
+        return false;
+    }
+
+    value = ret;
+
+    return true;
+}
+
+bool parse_uint(const char* str, uint32_t& value) {
+    char* end = nullptr;
+
+    const unsigned long ret = strtoul(str, &end, 10);
+    if (end == str || *end != '\0' || ret > UINT32_MAX) {
+        return false;
+    }
+
+    value = ret;
+
+    return true;
+}
+
+} // namespace
+
+DeadbandHandler::DeadbandHandler(DeadbandConfig& config)
+    : config_(config) {
+}
+
+status::StatusCode DeadbandHandler::handle(httpd_req_t* req) {
+    const size_t query_len = httpd_req_get_url_query_len(req);
+
+    if (query_len) {
+        if (query_len > max_query_len) {
+            return ResponseOps::send_text(req, HTTPD_400, "query too long");
+        }
+
+        char query[max_query_len + 1];
+
+        if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+            return ResponseOps::send_text(req, HTTPD_400, "invalid query");
+        }
+
+        char field[DeadbandConfig::max_field_len + 1];
+
+        if (httpd_query_key_value(query, "field", field, sizeof(field)) == ESP_OK) {
+            const char* error = nullptr;
+
+            const auto code = update_(query, field, error);
+            if (code == status::StatusCode::InvalidArg) {
+                return ResponseOps::send_text(req, HTTPD_400, error);
+            }
+            if (code != status::StatusCode::OK) {
+                return ResponseOps::send_text(req, HTTPD_500, status::code_to_str(code));
+            }
+        }
+    }
+
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = config_.format(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+status::StatusCode
+DeadbandHandler::update_(const char* query, const char* field, const char*& error) {
+    const bool is_default = strcmp(field, "default") == 0;
+
+    if (!*field) {
+        error = "empty field";
+        return status::StatusCode::InvalidArg;
+    }
+
+    char value[16];
+
+    if (httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK
+        && strcmp(value, "1") == 0) {
+        if (is_default) {
+            error = "default policy can't be reset";
+            return status::StatusCode::InvalidArg;
+        }
+
+        return config_.reset(field);
+    }
+
+    auto policy = is_default ? config_.get_default() : config_.get(field);
+
+    if (httpd_query_key_value(query, "absolute", value, sizeof(value)) == ESP_OK
+        && !parse_float(value, policy.absolute)) {
+        error = "invalid absolute";
+        return status::StatusCode::InvalidArg;
+    }
+
+    if (httpd_query_key_value(query, "relative", value, sizeof(value)) == ESP_OK
+        && !parse_float(value, policy.relative)) {
+        error = "invalid relative";
+        return status::StatusCode::InvalidArg;
+    }
+
+    if (httpd_query_key_value(query, "heartbeat", value, sizeof(value)) == ESP_OK
+        && !parse_uint(value, policy.heartbeat)) {
+        error = "invalid heartbeat";
+        return status::StatusCode::InvalidArg;
+    }
+
+    return config_.set(is_default ? nullptr : field, policy);
+}
+
+} // namespace bonsai
+} // namespace ocs
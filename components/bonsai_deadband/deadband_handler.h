@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_deadband/deadband_config.h"
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Configure the deadband policies over HTTP.
+//!
+//! @remarks
+//!  Query parameters:
+//!   - field - field name, "default" for the default policy. If omitted, the
+//!     policies are returned as is.
+//!   - absolute, relative, heartbeat - policy parameters, see DeadbandConfig::Policy.
+//!     The omitted parameters are left unchanged.
+//!   - reset - if "1", the field policy is removed.
+//!
+//!  The response contains all the policies.
+class DeadbandHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit DeadbandHandler(DeadbandConfig& config);
+
+    //! Handle HTTP request.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    status::StatusCode update_(const char* query, const char* field, const char*& error);
+
+    DeadbandConfig& config_;
+};
+
+} // namespace bonsai
+} // namespace ocs
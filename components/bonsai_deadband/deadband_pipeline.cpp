@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_deadband/deadband_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+DeadbandPipeline::DeadbandPipeline(core::IClock& clock,
+                                   WriteBehindPipeline& write_behind_pipeline,
+                                   http::IRouter& router)
+    : clock_(clock) {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEADBAND_ENABLE
+    config_.reset(new (std::nothrow) DeadbandConfig(
+        write_behind_pipeline.make("deadband"),
+        DeadbandConfig::Policy {
+            .absolute = 0,
+            .relative = CONFIG_BONSAI_FIRMWARE_DEADBAND_DEFAULT_RELATIVE_THRESHOLD,
+            .heartbeat = CONFIG_BONSAI_FIRMWARE_DEADBAND_DEFAULT_HEARTBEAT,
+        },
+        CONFIG_BONSAI_FIRMWARE_DEADBAND_MAX_POLICY_COUNT));
+    configASSERT(config_);
+
+    handler_.reset(new (std::nothrow) DeadbandHandler(*config_));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/config/deadband",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)write_behind_pipeline;
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_DEADBAND_ENABLE
+}
+
+DeadbandFilter* DeadbandPipeline::make_filter() {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEADBAND_ENABLE
+    std::unique_ptr<DeadbandFilter> filter(new (std::nothrow) DeadbandFilter(
+        clock_, *config_, CONFIG_BONSAI_FIRMWARE_DEADBAND_MAX_FIELD_COUNT));
+    configASSERT(filter);
+
+    DeadbandFilter* ret = filter.get();
+    filters_.push_back(std::move(filter));
+
+    return ret;
+#else
+    return nullptr;
+#endif // CONFIG_BONSAI_FIRMWARE_DEADBAND_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_deadband/deadband_config.h"
+#include "bonsai_deadband/deadband_filter.h"
+#include "bonsai_deadband/deadband_handler.h"
+#include "bonsai_storage/write_behind_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Report-by-exception stage between the sensors and the push outputs.
+//!
+//! @remarks
+//!  The policies are persisted in the "deadband" storage and configured via
+//!  GET /api/v1/config/deadband, see DeadbandHandler.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_DEADBAND_ENABLE is disabled, no filters are created.
+class DeadbandPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    DeadbandPipeline(core::IClock& clock,
+                     WriteBehindPipeline& write_behind_pipeline,
+                     http::IRouter& router);
+
+    //! Create the filter for a single output.
+    //!
+    //! @return
+    //!  nullptr if the filtering is disabled, all the fields should be reported.
+    //!
+    //! @notes
+    //!  The filter is owned by the pipeline.
+    DeadbandFilter* make_filter();
+
+private:
+    core::IClock& clock_;
+
+    std::unique_ptr<DeadbandConfig> config_;
+    std::unique_ptr<DeadbandHandler> handler_;
+
+    std::vector<std::unique_ptr<DeadbandFilter>> filters_;
+};
+
+} // namespace bonsai
+} // namespace ocs
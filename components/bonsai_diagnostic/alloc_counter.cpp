@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/alloc_counter.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* counter_ids[static_cast<unsigned>(AllocDomain::Last)][2] = {
+    { "alloc_other_count", "alloc_other_bytes" },
+    { "alloc_http_count", "alloc_http_bytes" },
+    { "alloc_json_count", "alloc_json_bytes" },
+    { "alloc_sensor_count", "alloc_sensor_bytes" },
+    { "alloc_storage_count", "alloc_storage_bytes" },
+};
+
+const char* get_counter_id(AllocDomain domain, AllocCounter::Field field) {
+    configASSERT(domain < AllocDomain::Last);
+
+    return counter_ids[static_cast<unsigned>(domain)][static_cast<unsigned>(field)];
+}
+
+} // namespace
+
+AllocCounter::AllocCounter(AllocDomain domain, Field field)
+    : diagnostic::BasicCounter(get_counter_id(domain, field))
+    , domain_(domain)
+    , field_(field) {
+}
+
+diagnostic::ICounter::Value AllocCounter::get() const {
+    switch (field_) {
+    case Field::Count:
+        return AllocTracker::get_count(domain_);
+
+    case Field::Bytes:
+        return AllocTracker::get_bytes(domain_);
+    }
+
+    return 0;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_diagnostic/basic_counter.h"
+
+#include "bonsai_core/alloc_tracker.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Expose the per-domain allocation statistics as a diagnostic counter.
+class AllocCounter : public diagnostic::BasicCounter {
+public:
+    //! Counted value.
+    enum class Field {
+        //! Number of allocations.
+        Count,
+
+        //! Number of allocated bytes.
+        Bytes,
+    };
+
+    //! Initialize.
+    AllocCounter(AllocDomain domain, Field field);
+
+    //! Return the current counter value.
+    diagnostic::ICounter::Value get() const override;
+
+private:
+    const AllocDomain domain_ { AllocDomain::Other };
+    const Field field_ { Field::Count };
+};
+
+} // namespace bonsai
+} // namespace ocs
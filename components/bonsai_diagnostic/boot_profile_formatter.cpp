@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_core/boot_profiler.h"
+#include "bonsai_diagnostic/boot_profile_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+status::StatusCode BootProfileFormatter::format(cJSON* json) {
+    cJSON* array = cJSON_AddArrayToObject(json, "stages");
+    if (!array) {
+        return status::StatusCode::NoMem;
+    }
+
+    int64_t prev_timestamp = 0;
+
+    const unsigned count = BootProfiler::get_count();
+
+    for (unsigned n = 0; n < count; ++n) {
+        const auto stage = BootProfiler::get_stage(n);
+
+        cJSON* item = cJSON_CreateObject();
+        if (!item) {
+            return status::StatusCode::NoMem;
+        }
+
+        cJSON_AddItemToArray(array, item);
+
+        fmt::json::CjsonObjectFormatter formatter(item);
+
+        if (!formatter.add_string_ref_cs("id", stage.id)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("time_us", stage.timestamp)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("delta_us", stage.timestamp - prev_timestamp)) {
+            return status::StatusCode::NoMem;
+        }
+
+        prev_timestamp = stage.timestamp;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the boot stages recorded by the boot profiler.
+class BootProfileFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Format the stages into @p json.
+    //!
+    //! @remarks
+    //!  Each stage is formatted with the time since the chip reset and the time since
+    //!  the previous stage, both in microseconds.
+    status::StatusCode format(cJSON* json) override;
+};
+
+} // namespace bonsai
+} // namespace ocs
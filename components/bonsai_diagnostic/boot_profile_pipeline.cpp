@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/boot_profile_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+BootProfilePipeline::BootProfilePipeline(http::IRouter& router) {
+    formatter_.reset(new (std::nothrow) BootProfileFormatter());
+    configASSERT(formatter_);
+
+    handler_.reset(new (std::nothrow) JsonStreamHandler(
+        *formatter_, CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/boot",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+}
+
+} // namespace bonsai
+} // namespace ocs
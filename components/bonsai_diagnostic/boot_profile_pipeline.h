@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_diagnostic/boot_profile_formatter.h"
+#include "bonsai_http/json_stream_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Boot stage timestamps.
+//!
+//! @remarks
+//!  The stages recorded by the boot profiler are available via
+//!  GET /api/v1/diagnostic/boot.
+class BootProfilePipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit BootProfilePipeline(http::IRouter& router);
+
+private:
+    std::unique_ptr<BootProfileFormatter> formatter_;
+    std::unique_ptr<JsonStreamHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdio>
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_diagnostic/coredump_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+CoredumpFormatter::CoredumpFormatter(CoredumpReader& reader)
+    : reader_(reader) {
+}
+
+status::StatusCode CoredumpFormatter::format(cJSON* json) {
+    CoredumpReader::Summary summary;
+    if (!reader_.get_summary(summary)) {
+        return status::StatusCode::OK;
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_number_cs("coredump_size", reader_.get_size())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_string_copy_cs("coredump_task", summary.task)) {
+        return status::StatusCode::NoMem;
+    }
+
+    char pc[16];
+    snprintf(pc, sizeof(pc), "0x%08lx", static_cast<unsigned long>(summary.pc));
+
+    if (!formatter.add_string_copy_cs("coredump_pc", pc)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (summary.backtrace_depth) {
+        // "0x%08lx " per frame, and the corruption mark.
+        char backtrace[CoredumpReader::max_backtrace_depth * 11 + 4];
+        size_t size = 0;
+
+        for (unsigned n = 0; n < summary.backtrace_depth; ++n) {
+            size += snprintf(backtrace + size, sizeof(backtrace) - size, "%s0x%08lx",
+                             n ? " " : "",
+                             static_cast<unsigned long>(summary.backtrace[n]));
+        }
+
+        if (summary.backtrace_corrupted) {
+            snprintf(backtrace + size, sizeof(backtrace) - size, " |<-");
+        }
+
+        if (!formatter.add_string_copy_cs("coredump_backtrace", backtrace)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_diagnostic/coredump_reader.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the summary of the saved coredump.
+class CoredumpFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit CoredumpFormatter(CoredumpReader& reader);
+
+    //! Format the crashed task, the program counter and the backtrace into @p json.
+    //!
+    //! @remarks
+    //!  Nothing is formatted if there is no valid coredump.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    CoredumpReader& reader_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+#include "ocs_status/macros.h"
+
+#include "bonsai_diagnostic/coredump_handler.h"
+#include "bonsai_http/http_chunk_writer.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "coredump_handler";
+
+const char* content_disposition = "attachment; filename=coredump.elf";
+
+bool parse_size(const char* begin, const char* end, size_t& value) {
+    if (begin == end) {
+        return false;
+    }
+
+    value = 0;
+
+    for (const char* p = begin; p != end; ++p) {
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+
+        const size_t digit = *p - '0';
+
+        if (value > (SIZE_MAX - digit) / 10) {
+            return false;
+        }
+
+        value = value * 10 + digit;
+    }
+
+    return true;
+}
+
+} // namespace
+
+CoredumpHandler::CoredumpHandler(CoredumpReader& reader, size_t chunk_size)
+    : reader_(reader)
+    , chunk_size_(chunk_size) {
+    chunk_.reset(new (std::nothrow) char[chunk_size_]);
+    configASSERT(chunk_);
+}
+
+status::StatusCode CoredumpHandler::handle(httpd_req_t* req) {
+    const size_t size = reader_.get_size();
+    if (!size) {
+        return ResponseOps::send_text(req, HTTPD_404, "coredump not found");
+    }
+
+    if (req->method == HTTP_POST) {
+        return handle_erase_(req);
+    }
+
+    return handle_get_(req, size);
+}
+
+status::StatusCode CoredumpHandler::handle_get_(httpd_req_t* req, size_t size) {
+    Range range;
+    range.end = size - 1;
+
+    bool partial = false;
+
+    // Should be valid until the response is sent.
+    char content_range[48];
+
+    if (httpd_req_get_hdr_value_len(req, "Range")) {
+        char range_hdr[48];
+
+        const auto err =
+            httpd_req_get_hdr_value_str(req, "Range", range_hdr, sizeof(range_hdr));
+        if (err != ESP_OK || !parse_range_(range_hdr, size, range)) {
+            snprintf(content_range, sizeof(content_range), "bytes */%u",
+                     static_cast<unsigned>(size));
+
+            if (httpd_resp_set_hdr(req, "Content-Range", content_range) != ESP_OK) {
+                return status::StatusCode::Error;
+            }
+
+            return ResponseOps::send_text(req, "416 Range Not Satisfiable",
+                                          "invalid range");
+        }
+
+        partial = true;
+    }
+
+    if (httpd_resp_set_type(req, HTTPD_TYPE_OCTET) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    if (httpd_resp_set_hdr(req, "Accept-Ranges", "bytes") != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    if (httpd_resp_set_hdr(req, "Content-Disposition", content_disposition) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    if (partial) {
+        snprintf(content_range, sizeof(content_range), "bytes %u-%u/%u",
+                 static_cast<unsigned>(range.begin), static_cast<unsigned>(range.end),
+                 static_cast<unsigned>(size));
+
+        if (httpd_resp_set_status(req, "206 Partial Content") != ESP_OK) {
+            return status::StatusCode::Error;
+        }
+
+        if (httpd_resp_set_hdr(req, "Content-Range", content_range) != ESP_OK) {
+            return status::StatusCode::Error;
+        }
+    }
+
+    HttpChunkWriter writer(req);
+
+    for (size_t offset = range.begin; offset <= range.end;) {
+        const size_t n = std::min(chunk_size_, range.end - offset + 1);
+
+        OCS_STATUS_RETURN_ON_ERROR(reader_.read(offset, chunk_.get(), n));
+        OCS_STATUS_RETURN_ON_ERROR(writer.write(chunk_.get(), n));
+
+        offset += n;
+    }
+
+    return writer.finish();
+}
+
+status::StatusCode CoredumpHandler::handle_erase_(httpd_req_t* req) {
+    const auto code = reader_.erase();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to erase coredump: %s", status::code_to_str(code));
+
+        return ResponseOps::send_text(req, HTTPD_500, "failed to erase coredump");
+    }
+
+    return ResponseOps::send_text(req, HTTPD_200, "coredump erased");
+}
+
+bool CoredumpHandler::parse_range_(const char* str, size_t size, Range& range) {
+    const char* prefix = "bytes=";
+    if (strncmp(str, prefix, strlen(prefix)) != 0) {
+        return false;
+    }
+
+    const char* begin = str + strlen(prefix);
+    const char* end = begin + strlen(begin);
+
+    const char* dash = strchr(begin, '-');
+    if (!dash) {
+        return false;
+    }
+
+    size_t first = 0;
+    size_t last = size - 1;
+
+    if (dash == begin) {
+        // Suffix range, the last N bytes.
+        size_t count = 0;
+        if (!parse_size(dash + 1, end, count) || !count) {
+            return false;
+        }
+
+        first = count < size ? size - count : 0;
+    } else {
+        if (!parse_size(begin, dash, first)) {
+            return false;
+        }
+
+        if (dash + 1 != end) {
+            if (!parse_size(dash + 1, end, last)) {
+                return false;
+            }
+
+            last = std::min(last, size - 1);
+        }
+    }
+
+    if (first >= size || first > last) {
+        return false;
+    }
+
+    range.begin = first;
+    range.end = last;
+
+    return true;
+}
+
+} // namespace bonsai
+} // namespace ocs
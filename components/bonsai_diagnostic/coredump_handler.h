@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_diagnostic/coredump_reader.h"
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Stream and erase the saved coredump.
+//!
+//! @remarks
+//!  GET: the coredump is sent as application/octet-stream in the ELF format, it's read
+//!  from flash chunk by chunk while sending. Single byte range is supported with the
+//!  Range header, e.g. "Range: bytes=1024-", to resume the interrupted download.
+//!
+//!  POST: erase the coredump, once it was downloaded completely. GET never modifies
+//!  the coredump, so it's safe to retry, prefetch or cache.
+class CoredumpHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p reader to read the coredump from flash.
+    //!  - @p chunk_size - size of the chunk buffer, in bytes.
+    CoredumpHandler(CoredumpReader& reader, size_t chunk_size);
+
+    //! Send or erase the coredump, depending on the request method.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    struct Range {
+        size_t begin { 0 };
+        size_t end { 0 };
+    };
+
+    status::StatusCode handle_get_(httpd_req_t* req, size_t size);
+    status::StatusCode handle_erase_(httpd_req_t* req);
+
+    static bool parse_range_(const char* str, size_t size, Range& range);
+
+    CoredumpReader& reader_;
+
+    const size_t chunk_size_ { 0 };
+    std::unique_ptr<char[]> chunk_;
+};
+
+} // namespace bonsai
+} // namespace ocs
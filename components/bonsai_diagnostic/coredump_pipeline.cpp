@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/coredump_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+CoredumpPipeline::CoredumpPipeline(fmt::json::FanoutFormatter& registration_formatter,
+                                   http::IRouter& router) {
+    reader_.reset(new (std::nothrow) CoredumpReader());
+    configASSERT(reader_);
+
+    formatter_.reset(new (std::nothrow) CoredumpFormatter(*reader_));
+    configASSERT(formatter_);
+
+    registration_formatter.add(*formatter_);
+
+    handler_.reset(new (std::nothrow) CoredumpHandler(
+        *reader_, CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/coredump",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+    router.add(http::IRouter::Method::Post, "/api/v1/diagnostic/coredump",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+}
+
+fmt::json::IFormatter& CoredumpPipeline::get_formatter() {
+    return *formatter_;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_diagnostic/coredump_formatter.h"
+#include "bonsai_diagnostic/coredump_handler.h"
+#include "bonsai_diagnostic/coredump_reader.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Remote access to the coredump saved by the previous crash.
+//!
+//! @remarks
+//!  - Summary of the coredump, the crashed task, the program counter and the backtrace,
+//!    is added to the registration data.
+//!  - Coredump is available via GET /api/v1/diagnostic/coredump and is erased via
+//!    POST to the same path, see CoredumpHandler for the details.
+//!
+//!  Requires the coredump to be saved to flash in the ELF format.
+class CoredumpPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    CoredumpPipeline(fmt::json::FanoutFormatter& registration_formatter,
+                     http::IRouter& router);
+
+    //! Return the formatter of the coredump summary.
+    fmt::json::IFormatter& get_formatter();
+
+private:
+    std::unique_ptr<CoredumpReader> reader_;
+    std::unique_ptr<CoredumpFormatter> formatter_;
+    std::unique_ptr<CoredumpHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
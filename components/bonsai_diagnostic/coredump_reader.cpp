@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_core_dump.h"
+
+#include "ocs_core/log.h"
+
+#include "bonsai_diagnostic/coredump_reader.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "coredump_reader";
+
+} // namespace
+
+CoredumpReader::CoredumpReader() {
+    memset(summary_.task, 0, sizeof(summary_.task));
+    memset(summary_.backtrace, 0, sizeof(summary_.backtrace));
+
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                          ESP_PARTITION_SUBTYPE_DATA_COREDUMP, nullptr);
+    if (!partition_) {
+        ocs_logw(log_tag, "coredump partition not found");
+        return;
+    }
+
+    load_();
+}
+
+bool CoredumpReader::is_valid() const {
+    MutexLock lock(mu_);
+
+    return valid_;
+}
+
+size_t CoredumpReader::get_size() const {
+    MutexLock lock(mu_);
+
+    return valid_ ? size_ : 0;
+}
+
+bool CoredumpReader::get_summary(Summary& summary) const {
+    MutexLock lock(mu_);
+
+    if (!valid_) {
+        return false;
+    }
+
+    summary = summary_;
+    return true;
+}
+
+status::StatusCode CoredumpReader::read(size_t offset, void* buf, size_t size) const {
+    MutexLock lock(mu_);
+
+    if (!valid_) {
+        return status::StatusCode::InvalidState;
+    }
+
+    if (offset > size_ || size > size_ - offset) {
+        return status::StatusCode::InvalidArg;
+    }
+
+    const auto err = esp_partition_read(partition_, offset_ + offset, buf, size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_read(): offset=%u size=%u err=%s",
+                 static_cast<unsigned>(offset), static_cast<unsigned>(size),
+                 esp_err_to_name(err));
+
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode CoredumpReader::erase() {
+    MutexLock lock(mu_);
+
+    const auto err = esp_core_dump_image_erase();
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_core_dump_image_erase(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    valid_ = false;
+
+    ocs_logi(log_tag, "coredump erased: size=%u", static_cast<unsigned>(size_));
+
+    return status::StatusCode::OK;
+}
+
+void CoredumpReader::load_() {
+    size_t addr = 0;
+    size_t size = 0;
+
+    auto err = esp_core_dump_image_get(&addr, &size);
+    if (err != ESP_OK) {
+        // ESP_ERR_INVALID_SIZE is returned for the erased partition.
+        if (err != ESP_ERR_INVALID_SIZE) {
+            ocs_logw(log_tag, "esp_core_dump_image_get(): %s", esp_err_to_name(err));
+        }
+
+        return;
+    }
+
+    if (addr < partition_->address || size > partition_->size
+        || addr - partition_->address > partition_->size - size) {
+        ocs_logw(log_tag, "coredump is outside of the partition: addr=%u size=%u",
+                 static_cast<unsigned>(addr), static_cast<unsigned>(size));
+        return;
+    }
+
+    err = esp_core_dump_image_check();
+    if (err != ESP_OK) {
+        ocs_logw(log_tag, "esp_core_dump_image_check(): %s", esp_err_to_name(err));
+        return;
+    }
+
+#ifdef CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
+    esp_core_dump_summary_t summary;
+    memset(&summary, 0, sizeof(summary));
+
+    err = esp_core_dump_get_summary(&summary);
+    if (err != ESP_OK) {
+        ocs_logw(log_tag, "esp_core_dump_get_summary(): %s", esp_err_to_name(err));
+    } else {
+        strncpy(summary_.task, summary.exc_task, sizeof(summary_.task) - 1);
+        summary_.pc = summary.exc_pc;
+
+#if CONFIG_IDF_TARGET_ARCH_XTENSA
+        summary_.backtrace_depth =
+            std::min<unsigned>(summary.exc_bt_info.depth, max_backtrace_depth);
+        summary_.backtrace_corrupted = summary.exc_bt_info.corrupted;
+
+        for (unsigned n = 0; n < summary_.backtrace_depth; ++n) {
+            summary_.backtrace[n] = summary.exc_bt_info.bt[n];
+        }
+#endif // CONFIG_IDF_TARGET_ARCH_XTENSA
+    }
+#endif // CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
+
+    offset_ = addr - partition_->address;
+    size_ = size;
+    valid_ = true;
+
+    ocs_logw(log_tag, "coredump found: size=%u task=%s pc=0x%08lx",
+             static_cast<unsigned>(size_), summary_.task,
+             static_cast<unsigned long>(summary_.pc));
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_partition.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Access the coredump saved to flash by the previous crash.
+//!
+//! @remarks
+//!  The coredump is read directly from the coredump partition, it's never loaded to RAM
+//!  as a whole. The summary is loaded once during initialization, since it requires the
+//!  whole image to be read to verify the checksum.
+class CoredumpReader : public core::NonCopyable<> {
+public:
+    //! Maximum number of backtrace frames.
+    static constexpr unsigned max_backtrace_depth = 16;
+
+    //! Crash summary.
+    struct Summary {
+        //! Name of the task which caused the crash.
+        char task[16];
+
+        //! Program counter at the moment of the crash.
+        uint32_t pc { 0 };
+
+        //! Backtrace, the most recent frame first.
+        //!
+        //! @remarks
+        //!  Only available on Xtensa targets.
+        uint32_t backtrace[max_backtrace_depth];
+
+        //! Number of frames in the backtrace.
+        unsigned backtrace_depth { 0 };
+
+        //! True if the backtrace is corrupted.
+        bool backtrace_corrupted { false };
+    };
+
+    //! Initialize.
+    //!
+    //! @remarks
+    //!  Locate the coredump partition and load the summary of the saved coredump.
+    CoredumpReader();
+
+    //! Return true if the valid coredump is saved in flash.
+    bool is_valid() const;
+
+    //! Return the coredump size, in bytes.
+    size_t get_size() const;
+
+    //! Return the summary of the saved coredump.
+    //!
+    //! @return
+    //!  False if there is no valid coredump.
+    bool get_summary(Summary& summary) const;
+
+    //! Read @p size bytes of the coredump starting from @p offset into @p buf.
+    status::StatusCode read(size_t offset, void* buf, size_t size) const;
+
+    //! Erase the saved coredump.
+    status::StatusCode erase();
+
+private:
+    void load_();
+
+    const esp_partition_t* partition_ { nullptr };
+
+    mutable StaticMutex mu_;
+
+    bool valid_ { false };
+    size_t offset_ { 0 };
+    size_t size_ { 0 };
+    Summary summary_;
+};
+
+} // namespace bonsai
+} // namespace ocs
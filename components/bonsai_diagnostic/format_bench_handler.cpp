@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "esp_timer.h"
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_diagnostic/format_bench_handler.h"
+#include "bonsai_diagnostic/task_alloc_counter.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const unsigned default_iterations = 100;
+
+} // namespace
+
+void FormatBenchHandler::add(fmt::json::IFormatter& formatter, const char* id) {
+    entries_.push_back(Entry {
+        .formatter = &formatter,
+        .id = id,
+    });
+}
+
+status::StatusCode FormatBenchHandler::handle(httpd_req_t* req) {
+    unsigned iterations = default_iterations;
+    char id[32] = {};
+
+    char query[64];
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        char value[8];
+
+        if (httpd_query_key_value(query, "iterations", value, sizeof(value)) == ESP_OK) {
+            iterations = strtoul(value, nullptr, 10);
+            if (!iterations || iterations > max_iterations) {
+                return ResponseOps::send_text(req, HTTPD_400, "invalid iterations");
+            }
+        }
+
+        httpd_query_key_value(query, "id", id, sizeof(id));
+    }
+
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(json.get());
+
+    if (!formatter.add_number_cs("iterations", iterations)) {
+        return status::StatusCode::NoMem;
+    }
+
+    cJSON* array = cJSON_AddArrayToObject(json.get(), "results");
+    if (!array) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (const auto& entry : entries_) {
+        if (*id && strcmp(id, entry.id) != 0) {
+            continue;
+        }
+
+        const auto code = run_(array, entry, iterations);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+status::StatusCode FormatBenchHandler::run_(cJSON* array,
+                                            const Entry& entry,
+                                            unsigned iterations) {
+    bool failed = false;
+    size_t size = 0;
+
+    TaskAllocCounter::begin();
+
+    const int64_t start = esp_timer_get_time();
+
+    for (unsigned n = 0; n < iterations && !failed; ++n) {
+        cJSON* data = cJSON_CreateObject();
+        if (!data) {
+            failed = true;
+            break;
+        }
+
+        if (entry.formatter->format(data) != status::StatusCode::OK) {
+            failed = true;
+        } else if (char* text = cJSON_PrintUnformatted(data)) {
+            size = strlen(text);
+            cJSON_free(text);
+        } else {
+            failed = true;
+        }
+
+        cJSON_Delete(data);
+    }
+
+    const int64_t elapsed = esp_timer_get_time() - start;
+
+    const auto stats = TaskAllocCounter::end();
+
+    cJSON* item = cJSON_CreateObject();
+    if (!item) {
+        return status::StatusCode::NoMem;
+    }
+
+    cJSON_AddItemToArray(array, item);
+
+    fmt::json::CjsonObjectFormatter formatter(item);
+
+    if (!formatter.add_string_ref_cs("id", entry.id)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_bool_cs("failed", failed)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("ns_per_op", elapsed * 1000 / iterations)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("allocs_per_op",
+                                 static_cast<double>(stats.count) / iterations)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("bytes_per_op", stats.bytes / iterations)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("peak_bytes_per_op", stats.peak_bytes)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("untracked_blocks", stats.untracked_count)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("size", size)) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Run the formatters in a loop and report the time and the allocations per run.
+//!
+//! @remarks
+//!  Each run formats the data into a new cJSON object, serializes it and releases
+//!  everything, the same as the HTTP handlers do. Query parameters:
+//!   - iterations - number of runs per formatter.
+//!   - id - run only the formatter with this identifier.
+//!
+//!  Runs are made in the HTTP server task, other tasks keep running, so the time is
+//!  only comparable between the builds on the same device and load. All heap
+//!  allocations of the HTTP server task are counted, see TaskAllocCounter.
+class FormatBenchHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Maximum number of runs per formatter.
+    static constexpr unsigned max_iterations = 10000;
+
+    //! Add @p formatter to the benchmark.
+    //!
+    //! @notes
+    //!  Should be called before the server is started. @p id should be valid during
+    //!  the handler lifetime.
+    void add(fmt::json::IFormatter& formatter, const char* id);
+
+    //! Run the benchmark and send the results as JSON.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    struct Entry {
+        fmt::json::IFormatter* formatter { nullptr };
+        const char* id { nullptr };
+    };
+
+    status::StatusCode run_(cJSON* array, const Entry& entry, unsigned iterations);
+
+    std::vector<Entry> entries_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/format_bench_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+FormatBenchPipeline::FormatBenchPipeline(http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_FORMAT_BENCH_ENABLE
+    handler_.reset(new (std::nothrow) FormatBenchHandler());
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/format_bench",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_FORMAT_BENCH_ENABLE
+}
+
+void FormatBenchPipeline::add(fmt::json::IFormatter& formatter, const char* id) {
+    if (handler_) {
+        handler_->add(formatter, id);
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
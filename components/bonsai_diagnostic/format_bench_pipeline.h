@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_diagnostic/format_bench_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Benchmark of the JSON formatters.
+//!
+//! @remarks
+//!  The benchmark is run via GET /api/v1/diagnostic/format_bench, see
+//!  FormatBenchHandler.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_FORMAT_BENCH_ENABLE is disabled, the endpoint isn't
+//!  registered.
+class FormatBenchPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit FormatBenchPipeline(http::IRouter& router);
+
+    //! Add @p formatter to the benchmark.
+    //!
+    //! @notes
+    //!  @p id should be valid during the pipeline lifetime.
+    void add(fmt::json::IFormatter& formatter, const char* id);
+
+private:
+    std::unique_ptr<FormatBenchHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "esp_heap_caps.h"
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_diagnostic/heap_formatter.h"
+#include "bonsai_diagnostic/heap_monitor.h"
+
+namespace ocs {
+namespace bonsai {
+
+status::StatusCode HeapFormatter::format(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    const auto pool = HeapMonitor::read_pool(MALLOC_CAP_DEFAULT);
+
+    if (!formatter.add_number_cs("heap_free", pool.free)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("heap_min_free", pool.min_free)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("heap_largest_free_block", pool.largest_free_block)) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
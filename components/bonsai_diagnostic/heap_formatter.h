@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the current heap statistics.
+class HeapFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Format free heap, minimum ever free heap and the largest free block into @p json.
+    status::StatusCode format(cJSON* json) override;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/time.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_diagnostic/heap_handler.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+bool format_pool(cJSON* json, const char* key, const HeapMonitor::Pool& pool) {
+    cJSON* item = cJSON_AddObjectToObject(json, key);
+    if (!item) {
+        return false;
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(item);
+
+    return formatter.add_number_cs("free", pool.free)
+        && formatter.add_number_cs("min_free", pool.min_free)
+        && formatter.add_number_cs("largest_free_block", pool.largest_free_block);
+}
+
+} // namespace
+
+HeapHandler::HeapHandler(HeapMonitor& monitor, fmt::json::IFormatter& counter_formatter)
+    : monitor_(monitor)
+    , counter_formatter_(counter_formatter) {
+    samples_.reset(new (std::nothrow) HeapMonitor::Sample[monitor_.get_capacity()]);
+    configASSERT(samples_);
+}
+
+status::StatusCode HeapHandler::handle(httpd_req_t* req) {
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = format_(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+status::StatusCode HeapHandler::format_(cJSON* json) {
+    auto code = format_pools_(json);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    code = format_counters_(json);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return format_samples_(json);
+}
+
+status::StatusCode HeapHandler::format_pools_(cJSON* json) {
+    if (!format_pool(json, "heap", HeapMonitor::read_pool(MALLOC_CAP_DEFAULT))) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!format_pool(json, "internal", HeapMonitor::read_pool(MALLOC_CAP_INTERNAL))) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!format_pool(json, "dma", HeapMonitor::read_pool(MALLOC_CAP_DMA))) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode HeapHandler::format_counters_(cJSON* json) {
+    cJSON* item = cJSON_AddObjectToObject(json, "counters");
+    if (!item) {
+        return status::StatusCode::NoMem;
+    }
+
+    return counter_formatter_.format(item);
+}
+
+status::StatusCode HeapHandler::format_samples_(cJSON* json) {
+    cJSON* array = cJSON_AddArrayToObject(json, "samples");
+    if (!array) {
+        return status::StatusCode::NoMem;
+    }
+
+    const unsigned count = monitor_.read(samples_.get(), monitor_.get_capacity());
+
+    for (unsigned n = 0; n < count; ++n) {
+        const auto& sample = samples_[n];
+
+        cJSON* item = cJSON_CreateObject();
+        if (!item) {
+            return status::StatusCode::NoMem;
+        }
+
+        cJSON_AddItemToArray(array, item);
+
+        fmt::json::CjsonObjectFormatter formatter(item);
+
+        if (!formatter.add_number_cs("timestamp",
+                                     sample.timestamp / core::Duration::second)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!format_pool(item, "heap", sample.heap)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!format_pool(item, "internal", sample.internal)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!format_pool(item, "dma", sample.dma)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
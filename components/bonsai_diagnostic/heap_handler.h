@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_diagnostic/heap_monitor.h"
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Report the heap statistics, the heap samples and the allocation counters.
+class HeapHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p monitor to read the heap samples from.
+    //!  - @p counter_formatter to format the allocation counters.
+    HeapHandler(HeapMonitor& monitor, fmt::json::IFormatter& counter_formatter);
+
+    //! Send the heap statistics as JSON.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    status::StatusCode format_(cJSON* json);
+    status::StatusCode format_pools_(cJSON* json);
+    status::StatusCode format_counters_(cJSON* json);
+    status::StatusCode format_samples_(cJSON* json);
+
+    HeapMonitor& monitor_;
+    fmt::json::IFormatter& counter_formatter_;
+
+    std::unique_ptr<HeapMonitor::Sample[]> samples_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <new>
+
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/heap_monitor.h"
+
+namespace ocs {
+namespace bonsai {
+
+HeapMonitor::Pool HeapMonitor::read_pool(uint32_t caps) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+
+    return Pool {
+        .free = static_cast<uint32_t>(info.total_free_bytes),
+        .min_free = static_cast<uint32_t>(info.minimum_free_bytes),
+        .largest_free_block = static_cast<uint32_t>(info.largest_free_block),
+    };
+}
+
+HeapMonitor::HeapMonitor(core::IClock& clock, unsigned capacity)
+    : capacity_(capacity)
+    , clock_(clock) {
+    configASSERT(capacity_);
+
+    samples_.reset(new (std::nothrow) Sample[capacity_]);
+    configASSERT(samples_);
+}
+
+unsigned HeapMonitor::get_capacity() const {
+    return capacity_;
+}
+
+unsigned HeapMonitor::read(Sample* samples, unsigned size) {
+    MutexLock lock(mu_);
+
+    const unsigned count = std::min(size, count_);
+    for (unsigned n = 0; n < count; ++n) {
+        samples[n] = samples_[(pos_ + capacity_ - count + n) % capacity_];
+    }
+
+    return count;
+}
+
+status::StatusCode HeapMonitor::run() {
+    const Sample sample {
+        .timestamp = clock_.now(),
+        .heap = read_pool(MALLOC_CAP_DEFAULT),
+        .internal = read_pool(MALLOC_CAP_INTERNAL),
+        .dma = read_pool(MALLOC_CAP_DMA),
+    };
+
+    MutexLock lock(mu_);
+
+    samples_[pos_] = sample;
+    pos_ = (pos_ + 1) % capacity_;
+    if (count_ < capacity_) {
+        ++count_;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
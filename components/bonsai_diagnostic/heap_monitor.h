@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Periodically sample the heap statistics into the ring buffer.
+class HeapMonitor : public scheduler::ITask, public core::NonCopyable<> {
+public:
+    //! Heap statistics for the memory with the particular capabilities.
+    struct Pool {
+        //! Number of free bytes.
+        uint32_t free { 0 };
+
+        //! Minimum number of free bytes since boot.
+        uint32_t min_free { 0 };
+
+        //! Size of the largest free block, in bytes.
+        uint32_t largest_free_block { 0 };
+    };
+
+    struct Sample {
+        //! Time when the sample was taken.
+        core::Time timestamp { 0 };
+
+        //! Default heap, used by malloc() and operator new.
+        Pool heap;
+
+        //! Internal memory.
+        Pool internal;
+
+        //! DMA-capable memory.
+        Pool dma;
+    };
+
+    //! Read the current statistics for the memory with @p caps capabilities.
+    static Pool read_pool(uint32_t caps);
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p clock to timestamp the samples.
+    //!  - @p capacity - maximum number of samples to keep.
+    HeapMonitor(core::IClock& clock, unsigned capacity);
+
+    //! Return the maximum number of samples to keep.
+    unsigned get_capacity() const;
+
+    //! Copy up to @p size the most recent samples into @p samples, oldest first.
+    //!
+    //! @return
+    //!  Number of copied samples.
+    unsigned read(Sample* samples, unsigned size);
+
+    //! Take a sample.
+    status::StatusCode run() override;
+
+private:
+    const unsigned capacity_ { 0 };
+
+    core::IClock& clock_;
+
+    StaticMutex mu_;
+
+    std::unique_ptr<Sample[]> samples_;
+    unsigned pos_ { 0 };
+    unsigned count_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/heap_monitor_pipeline.h"
+#include "bonsai_diagnostic/json_alloc_hooks.h"
+
+namespace ocs {
+namespace bonsai {
+
+HeapMonitorPipeline::HeapMonitorPipeline(
+    core::IClock& clock,
+    fmt::json::FanoutFormatter& telemetry_formatter,
+    fmt::json::FanoutFormatter& registration_formatter,
+    http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    JsonAllocHooks::install();
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+
+    monitor_.reset(new (std::nothrow) HeapMonitor(
+        clock, CONFIG_BONSAI_FIRMWARE_HEAP_MONITOR_SAMPLE_COUNT));
+    configASSERT(monitor_);
+
+    monitor_task_.reset(new (std::nothrow) PeriodicTask(
+        *monitor_, "heap_monitor",
+        PeriodicTask::Params {
+            .interval = core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_HEAP_MONITOR_SAMPLE_INTERVAL,
+            .stack_size = CONFIG_BONSAI_FIRMWARE_HEAP_MONITOR_STACK_SIZE,
+            .priority = tskIDLE_PRIORITY + 1,
+        }));
+    configASSERT(monitor_task_);
+
+    formatter_.reset(new (std::nothrow) HeapFormatter());
+    configASSERT(formatter_);
+
+    registration_formatter.add(*formatter_);
+
+    counter_formatter_.reset(new (std::nothrow) diagnostic::CounterJsonFormatter());
+    configASSERT(counter_formatter_);
+
+    const AllocCounter::Field fields[] = {
+        AllocCounter::Field::Count,
+        AllocCounter::Field::Bytes,
+    };
+
+    for (unsigned n = 0; n < static_cast<unsigned>(AllocDomain::Last); ++n) {
+        for (const auto field : fields) {
+            std::unique_ptr<AllocCounter> counter(
+                new (std::nothrow) AllocCounter(static_cast<AllocDomain>(n), field));
+            configASSERT(counter);
+
+            counter_formatter_->add(*counter);
+            counters_.push_back(std::move(counter));
+        }
+    }
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    telemetry_formatter.add(*counter_formatter_);
+#else
+    (void)telemetry_formatter;
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+
+    handler_.reset(new (std::nothrow) HeapHandler(*monitor_, *counter_formatter_));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/heap",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+}
+
+status::StatusCode HeapMonitorPipeline::start() {
+    return monitor_task_->start();
+}
+
+fmt::json::IFormatter& HeapMonitorPipeline::get_formatter() {
+    return *formatter_;
+}
+
+} // namespace bonsai
+} // namespace ocs
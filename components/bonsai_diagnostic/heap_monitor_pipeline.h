@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_diagnostic/counter_json_formatter.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_http/irouter.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_core/periodic_task.h"
+#include "bonsai_diagnostic/alloc_counter.h"
+#include "bonsai_diagnostic/heap_formatter.h"
+#include "bonsai_diagnostic/heap_handler.h"
+#include "bonsai_diagnostic/heap_monitor.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Heap statistics and per-subsystem allocation counters.
+//!
+//! @remarks
+//!  - Heap is sampled periodically by the dedicated low-priority task.
+//!  - Current heap statistics are added to the registration data.
+//!  - Allocation counters are added to the telemetry data.
+//!  - Current statistics, samples and counters are available via
+//!    GET /api/v1/diagnostic/heap.
+class HeapMonitorPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    HeapMonitorPipeline(core::IClock& clock,
+                        fmt::json::FanoutFormatter& telemetry_formatter,
+                        fmt::json::FanoutFormatter& registration_formatter,
+                        http::IRouter& router);
+
+    //! Start sampling the heap.
+    status::StatusCode start();
+
+    //! Return the formatter of the current heap statistics.
+    fmt::json::IFormatter& get_formatter();
+
+private:
+    std::unique_ptr<HeapMonitor> monitor_;
+    std::unique_ptr<PeriodicTask> monitor_task_;
+    std::unique_ptr<HeapFormatter> formatter_;
+    std::unique_ptr<HeapHandler> handler_;
+    std::unique_ptr<diagnostic::CounterJsonFormatter> counter_formatter_;
+    std::vector<std::unique_ptr<AllocCounter>> counters_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdlib>
+
+#include "cJSON.h"
+
+#include "bonsai_core/alloc_tracker.h"
+#include "bonsai_diagnostic/json_alloc_hooks.h"
+
+namespace ocs {
+namespace bonsai {
+
+std::atomic<bool> JsonAllocHooks::installed_ { false };
+
+void JsonAllocHooks::install() {
+    if (installed_.exchange(true)) {
+        return;
+    }
+
+    cJSON_Hooks hooks;
+    hooks.malloc_fn = malloc_;
+    hooks.free_fn = free_;
+    cJSON_InitHooks(&hooks);
+}
+
+void* JsonAllocHooks::malloc_(size_t size) {
+#ifdef CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+    AllocTracker::record(AllocDomain::Json, size);
+#endif // CONFIG_BONSAI_FIRMWARE_ALLOC_TRACKING_ENABLE
+
+    return malloc(size);
+}
+
+void JsonAllocHooks::free_(void* ptr) {
+    free(ptr);
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! cJSON allocation hooks.
+//!
+//! @remarks
+//!  Allocations are accounted to AllocDomain::Json, see AllocTracker. The hooks use
+//!  malloc() and free(), so they remain compatible with the blocks allocated before
+//!  they were installed.
+//!
+//!  The hooks are global, they're installed once at boot, if the allocation tracking
+//!  is enabled. To count the allocations of a particular task, see TaskAllocCounter.
+class JsonAllocHooks : public core::NonCopyable<> {
+public:
+    //! Install the hooks.
+    //!
+    //! @notes
+    //!  Can be called multiple times, the hooks are installed only once.
+    static void install();
+
+private:
+    static void* malloc_(size_t size);
+    static void free_(void* ptr);
+
+    static std::atomic<bool> installed_;
+};
+
+} // namespace bonsai
+} // namespace ocs
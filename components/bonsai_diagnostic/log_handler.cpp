@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_diagnostic/log_handler.h"
+#include "bonsai_http/http_chunk_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+char get_level_char(LogLevel level) {
+    switch (level) {
+    case LogLevel::Error:
+        return 'E';
+    case LogLevel::Warning:
+        return 'W';
+    case LogLevel::Info:
+        return 'I';
+    }
+
+    return '?';
+}
+
+} // namespace
+
+LogHandler::LogHandler(unsigned capacity)
+    : capacity_(capacity) {
+}
+
+status::StatusCode LogHandler::handle(httpd_req_t* req) {
+    std::unique_ptr<DeferredLog::Entry[]> entries(new (std::nothrow)
+                                                      DeferredLog::Entry[capacity_]);
+    if (!entries) {
+        return status::StatusCode::NoMem;
+    }
+
+    const unsigned entry_count = DeferredLog::read(entries.get(), capacity_);
+
+    if (httpd_resp_set_type(req, "text/plain") != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    HttpChunkWriter writer(req);
+
+    const uint32_t overwrite_count = DeferredLog::get_overwrite_count();
+    if (overwrite_count) {
+        char line[48];
+        snprintf(line, sizeof(line), "(%lu messages lost)\n",
+                 static_cast<unsigned long>(overwrite_count));
+
+        const auto code = writer.write(line, strlen(line));
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    for (unsigned n = 0; n < entry_count; ++n) {
+        const DeferredLog::Entry& entry = entries[n];
+
+        char message[128];
+        DeferredLog::format(entry, message, sizeof(message));
+
+        char line[192];
+        snprintf(line, sizeof(line), "%c (%lld) %s: %s\n", get_level_char(entry.level),
+                 static_cast<long long>(entry.timestamp / 1000), entry.tag, message);
+
+        const auto code = writer.write(line, strlen(line));
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    return writer.finish();
+}
+
+} // namespace bonsai
+} // namespace ocs
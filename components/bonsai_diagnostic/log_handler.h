@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the messages recorded by the deferred log.
+//!
+//! @remarks
+//!  The messages are formatted on request and sent as text/plain, one per line, in
+//!  the ESP-IDF log format: "<level> (<milliseconds>) <tag>: <message>".
+class LogHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p capacity - maximum number of messages to send.
+    explicit LogHandler(unsigned capacity);
+
+    //! Send the log.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    const unsigned capacity_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/log_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+LogPipeline::LogPipeline(http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+    handler_.reset(new (std::nothrow)
+                       LogHandler(CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_CAPACITY));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/log",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
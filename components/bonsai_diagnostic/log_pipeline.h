@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_diagnostic/log_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Firmware log kept in RAM.
+//!
+//! @remarks
+//!  The messages recorded by the deferred log are available via
+//!  GET /api/v1/diagnostic/log.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_DEFERRED_LOG_ENABLE is disabled, the messages are printed
+//!  immediately and the endpoint isn't registered.
+class LogPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit LogPipeline(http::IRouter& router);
+
+private:
+    std::unique_ptr<LogHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
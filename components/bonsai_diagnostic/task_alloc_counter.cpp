@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <atomic>
+#include <cstddef>
+
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "bonsai_diagnostic/task_alloc_counter.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+struct Block {
+    void* ptr { nullptr };
+    uint32_t size { 0 };
+};
+
+// The state is modified only by the counted task, the other tasks only compare
+// their handle with the counted one.
+std::atomic<TaskHandle_t> counted_task { nullptr };
+
+TaskAllocCounter::Stats stats;
+uint32_t used_bytes = 0;
+
+Block blocks[TaskAllocCounter::max_block_count];
+
+} // namespace
+
+void TaskAllocCounter::begin() {
+    configASSERT(!counted_task);
+
+    stats = Stats();
+    used_bytes = 0;
+
+    for (auto& block : blocks) {
+        block = Block();
+    }
+
+    counted_task = xTaskGetCurrentTaskHandle();
+}
+
+TaskAllocCounter::Stats TaskAllocCounter::end() {
+    configASSERT(counted_task == xTaskGetCurrentTaskHandle());
+
+    counted_task = nullptr;
+
+    return stats;
+}
+
+} // namespace bonsai
+} // namespace ocs
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+
+// The hooks are called by the heap functions, so they should be placed into IRAM and
+// shouldn't call the heap functions.
+extern "C" IRAM_ATTR void esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t) {
+    using namespace ocs::bonsai;
+
+    if (!ptr || counted_task != xTaskGetCurrentTaskHandle()) {
+        return;
+    }
+
+    ++stats.count;
+    stats.bytes += size;
+
+    used_bytes += size;
+    if (used_bytes > stats.peak_bytes) {
+        stats.peak_bytes = used_bytes;
+    }
+
+    for (auto& block : blocks) {
+        if (!block.ptr) {
+            block.ptr = ptr;
+            block.size = size;
+
+            return;
+        }
+    }
+
+    ++stats.untracked_count;
+}
+
+extern "C" IRAM_ATTR void esp_heap_trace_free_hook(void* ptr) {
+    using namespace ocs::bonsai;
+
+    if (!ptr || counted_task != xTaskGetCurrentTaskHandle()) {
+        return;
+    }
+
+    for (auto& block : blocks) {
+        if (block.ptr == ptr) {
+            used_bytes -= block.size;
+            block = Block();
+
+            return;
+        }
+    }
+}
+
+#endif // CONFIG_HEAP_USE_HOOKS
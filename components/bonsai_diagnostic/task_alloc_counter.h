@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Count the heap allocations of a single task.
+//!
+//! @remarks
+//!  All heap allocations are counted: malloc(), operator new, cJSON, the ESP-IDF
+//!  drivers. The heap allocation hooks are used, so it requires CONFIG_HEAP_USE_HOOKS,
+//!  otherwise nothing is counted.
+//!
+//!  Allocations made by other tasks in the meantime aren't counted. The blocks
+//!  allocated before begin() don't affect the number of bytes in use when released.
+class TaskAllocCounter : public core::NonCopyable<> {
+public:
+    //! Maximum number of blocks tracked at the same time, to calculate the peak.
+    static constexpr unsigned max_block_count = 128;
+
+    struct Stats {
+        //! Number of allocations.
+        uint32_t count { 0 };
+
+        //! Number of allocated bytes.
+        uint32_t bytes { 0 };
+
+        //! Maximum number of bytes in use at the same time.
+        uint32_t peak_bytes { 0 };
+
+        //! Number of blocks which didn't fit into the tracking table.
+        //!
+        //! @remarks
+        //!  Such blocks are considered as never released, so the peak is overestimated.
+        uint32_t untracked_count { 0 };
+    };
+
+    //! Start counting the allocations of the current task.
+    //!
+    //! @notes
+    //!  Only one task can be counted at a time.
+    static void begin();
+
+    //! Stop counting the allocations and return the statistics since begin().
+    //!
+    //! @notes
+    //!  Should be called by the same task as begin().
+    static Stats end();
+};
+
+} // namespace bonsai
+} // namespace ocs
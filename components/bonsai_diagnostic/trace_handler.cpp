@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "bonsai_diagnostic/trace_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char magic[] = { 'B', 'T', 'R', 'C' };
+
+const size_t header_size = 16;
+const size_t event_size = 14;
+
+void write_le(uint8_t* buf, uint64_t value, size_t size) {
+    for (size_t n = 0; n < size; ++n) {
+        buf[n] = static_cast<uint8_t>(value >> (n * 8));
+    }
+}
+
+uint16_t find_string(std::vector<const char*>& strings, const char* str) {
+    for (size_t n = 0; n < strings.size(); ++n) {
+        if (strings[n] == str) {
+            return n;
+        }
+    }
+
+    strings.push_back(str);
+
+    return strings.size() - 1;
+}
+
+} // namespace
+
+TraceHandler::Writer::Writer(HttpChunkWriter& writer)
+    : writer_(writer) {
+}
+
+status::StatusCode TraceHandler::Writer::write(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    while (size) {
+        if (size_ == sizeof(buf_)) {
+            const auto code = flush();
+            if (code != status::StatusCode::OK) {
+                return code;
+            }
+        }
+
+        const size_t n = std::min(size, sizeof(buf_) - size_);
+
+        memcpy(buf_ + size_, bytes, n);
+        size_ += n;
+        bytes += n;
+        size -= n;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode TraceHandler::Writer::write_string(const char* str) {
+    const size_t size = std::min<size_t>(strlen(str), UINT8_MAX);
+
+    const uint8_t len = size;
+
+    const auto code = write(&len, sizeof(len));
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return write(str, size);
+}
+
+status::StatusCode TraceHandler::Writer::flush() {
+    if (!size_) {
+        return status::StatusCode::OK;
+    }
+
+    const auto code = writer_.write(reinterpret_cast<const char*>(buf_), size_);
+    size_ = 0;
+
+    return code;
+}
+
+TraceHandler::TraceHandler(unsigned capacity)
+    : capacity_(capacity) {
+}
+
+status::StatusCode TraceHandler::handle(httpd_req_t* req) {
+    std::unique_ptr<Tracer::Event[]> events(new (std::nothrow) Tracer::Event[capacity_]);
+    if (!events) {
+        return status::StatusCode::NoMem;
+    }
+
+    const unsigned event_count = Tracer::read(events.get(), capacity_);
+    const unsigned task_count = Tracer::get_task_count();
+
+    std::vector<const char*> strings;
+
+    for (unsigned n = 0; n < event_count; ++n) {
+        find_string(strings, events[n].name);
+        find_string(strings, events[n].category);
+    }
+
+    if (httpd_resp_set_type(req, "application/octet-stream") != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    HttpChunkWriter chunk_writer(req);
+    Writer writer(chunk_writer);
+
+    uint8_t header[header_size];
+    memcpy(header, magic, sizeof(magic));
+    write_le(header + 4, version, 1);
+    write_le(header + 5, 0, 1);
+    write_le(header + 6, strings.size(), 2);
+    write_le(header + 8, task_count, 2);
+    write_le(header + 10, 0, 2);
+    write_le(header + 12, event_count, 4);
+
+    auto code = writer.write(header, sizeof(header));
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    for (const char* str : strings) {
+        code = writer.write_string(str);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    for (unsigned n = 0; n < task_count; ++n) {
+        char name[32];
+        Tracer::get_task_name(n, name, sizeof(name));
+
+        code = writer.write_string(name);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    for (unsigned n = 0; n < event_count; ++n) {
+        const Tracer::Event& event = events[n];
+
+        uint8_t buf[event_size];
+        write_le(buf, static_cast<uint64_t>(event.timestamp), 8);
+        write_le(buf + 8, find_string(strings, event.name), 2);
+        write_le(buf + 10, find_string(strings, event.category), 2);
+        write_le(buf + 12, event.task, 1);
+        write_le(buf + 13, static_cast<uint8_t>(event.phase), 1);
+
+        code = writer.write(buf, sizeof(buf));
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    code = writer.flush();
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return chunk_writer.finish();
+}
+
+} // namespace bonsai
+} // namespace ocs
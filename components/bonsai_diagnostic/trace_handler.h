@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_core/tracer.h"
+#include "bonsai_http/http_chunk_writer.h"
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the events recorded by the tracer.
+//!
+//! @remarks
+//!  The trace is sent as application/octet-stream. All integers are little-endian.
+//!
+//!  Header, 16 bytes:
+//!   - magic, "BTRC".
+//!   - format version, u8.
+//!   - reserved, u8.
+//!   - number of strings, u16.
+//!   - number of tasks, u16.
+//!   - reserved, u16.
+//!   - number of events, u32.
+//!
+//!  Strings and then task names, each is the u8 length followed by the characters.
+//!
+//!  Event, 14 bytes:
+//!   - time since the chip reset, in microseconds, i64.
+//!   - name, index in the strings, u16.
+//!   - category, index in the strings, u16.
+//!   - task, index in the task names, 255 if unknown, u8.
+//!   - phase, see TracePhase, u8.
+class TraceHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Trace format version.
+    static constexpr uint8_t version = 1;
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p capacity - maximum number of events to send.
+    explicit TraceHandler(unsigned capacity);
+
+    //! Send the trace.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    class Writer : public core::NonCopyable<> {
+    public:
+        explicit Writer(HttpChunkWriter& writer);
+
+        status::StatusCode write(const void* data, size_t size);
+        status::StatusCode write_string(const char* str);
+        status::StatusCode flush();
+
+    private:
+        HttpChunkWriter& writer_;
+
+        uint8_t buf_[256];
+        size_t size_ { 0 };
+    };
+
+    const unsigned capacity_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
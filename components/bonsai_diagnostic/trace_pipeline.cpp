@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_diagnostic/trace_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+TracePipeline::TracePipeline(http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+    handler_.reset(new (std::nothrow)
+                       TraceHandler(CONFIG_BONSAI_FIRMWARE_TRACE_CAPACITY));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/trace",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_diagnostic/trace_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Timeline of the firmware activity.
+//!
+//! @remarks
+//!  The events recorded by the tracer are available via GET /api/v1/diagnostic/trace
+//! , see TraceHandler for the format.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE is disabled, the endpoint isn't registered.
+class TracePipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit TracePipeline(http::IRouter& router);
+
+private:
+    std::unique_ptr<TraceHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
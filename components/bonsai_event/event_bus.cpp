@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_event/event_bus.h"
+
+namespace ocs {
+namespace bonsai {
+
+EventBus::Subscriber::Subscriber(const char* id, Filter filter, unsigned capacity)
+    : id_(id)
+    , filter_(filter)
+    , queue_(capacity) {
+}
+
+const char* EventBus::Subscriber::get_id() const {
+    return id_;
+}
+
+bool EventBus::Subscriber::pop(SensorEvent& event) {
+    return queue_.pop(event);
+}
+
+unsigned EventBus::Subscriber::get_pending_count() const {
+    return queue_.get_size();
+}
+
+unsigned EventBus::Subscriber::get_capacity() const {
+    return queue_.get_capacity();
+}
+
+uint32_t EventBus::Subscriber::get_delivered_count() const {
+    return delivered_count_;
+}
+
+uint32_t EventBus::Subscriber::get_drop_count() const {
+    return drop_count_;
+}
+
+bool EventBus::Subscriber::match_(const SensorEvent& event) const {
+    if (filter_.type != SensorType::Last && filter_.type != event.type) {
+        return false;
+    }
+
+    if (filter_.sensor_id && strcmp(filter_.sensor_id, event.sensor_id) != 0) {
+        return false;
+    }
+
+    return true;
+}
+
+void EventBus::Subscriber::push_(const SensorEvent& event) {
+    if (queue_.push(event)) {
+        ++delivered_count_;
+    } else {
+        ++drop_count_;
+    }
+}
+
+EventBus::Subscriber&
+EventBus::subscribe(const char* id, Filter filter, unsigned capacity) {
+    std::unique_ptr<Subscriber> subscriber(new (std::nothrow)
+                                               Subscriber(id, filter, capacity));
+    configASSERT(subscriber);
+
+    Subscriber& ret = *subscriber;
+    subscribers_.push_back(std::move(subscriber));
+
+    return ret;
+}
+
+void EventBus::publish(const SensorEvent& event) {
+    ++published_count_;
+
+    for (auto& subscriber : subscribers_) {
+        if (subscriber->match_(event)) {
+            subscriber->push_(event);
+        }
+    }
+}
+
+uint32_t EventBus::get_published_count() const {
+    return published_count_;
+}
+
+unsigned EventBus::get_subscriber_count() const {
+    return subscribers_.size();
+}
+
+const EventBus::Subscriber& EventBus::get_subscriber(unsigned index) const {
+    configASSERT(index < subscribers_.size());
+    return *subscribers_[index];
+}
+
+} // namespace bonsai
+} // namespace ocs
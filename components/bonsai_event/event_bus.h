@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_event/sensor_event.h"
+#include "bonsai_event/spsc_queue.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! In-process bus delivering the sensor readings to the subscribers.
+//!
+//! @remarks
+//!  Each subscriber has its own fixed-capacity queue. If the subscriber doesn't keep
+//!  up, the new events are dropped and counted, the publisher is never blocked.
+//!
+//!  Events are published from the sensor read tasks, run by the task scheduler, each
+//!  subscriber is consumed by a single task, so every queue has a single producer and
+//!  a single consumer.
+class EventBus : public core::NonCopyable<> {
+public:
+    //! Events delivered to the subscriber.
+    struct Filter {
+        //! Sensor identifier, nullptr to receive events from all sensors.
+        const char* sensor_id { nullptr };
+
+        //! Sensor type, SensorType::Last to receive events of all types.
+        SensorType type { SensorType::Last };
+    };
+
+    class Subscriber : public core::NonCopyable<> {
+    public:
+        //! Initialize.
+        Subscriber(const char* id, Filter filter, unsigned capacity);
+
+        //! Return the subscriber identifier.
+        const char* get_id() const;
+
+        //! Remove the oldest event from the queue and store it in @p event.
+        //!
+        //! @return
+        //!  false if there are no pending events.
+        bool pop(SensorEvent& event);
+
+        //! Return the number of pending events.
+        unsigned get_pending_count() const;
+
+        //! Return the queue capacity.
+        unsigned get_capacity() const;
+
+        //! Return the number of queued events.
+        uint32_t get_delivered_count() const;
+
+        //! Return the number of events dropped because the queue was full.
+        uint32_t get_drop_count() const;
+
+    private:
+        friend class EventBus;
+
+        bool match_(const SensorEvent& event) const;
+        void push_(const SensorEvent& event);
+
+        const char* id_ { nullptr };
+        const Filter filter_;
+
+        SpscQueue<SensorEvent> queue_;
+
+        std::atomic<uint32_t> delivered_count_ { 0 };
+        std::atomic<uint32_t> drop_count_ { 0 };
+    };
+
+    //! Register a new subscriber.
+    //!
+    //! @params
+    //!  - @p id - subscriber identifier, should be valid during the bus lifetime.
+    //!  - @p filter - events delivered to the subscriber.
+    //!  - @p capacity - maximum number of pending events.
+    //!
+    //! @notes
+    //!  Should be called before the first event is published.
+    Subscriber& subscribe(const char* id, Filter filter, unsigned capacity);
+
+    //! Deliver @p event to all matching subscribers.
+    //!
+    //! @notes
+    //!  Should be called from a single task.
+    void publish(const SensorEvent& event);
+
+    //! Return the number of published events.
+    uint32_t get_published_count() const;
+
+    //! Return the number of subscribers.
+    unsigned get_subscriber_count() const;
+
+    //! Return the subscriber at @p index.
+    const Subscriber& get_subscriber(unsigned index) const;
+
+private:
+    std::atomic<uint32_t> published_count_ { 0 };
+
+    std::vector<std::unique_ptr<Subscriber>> subscribers_;
+};
+
+} // namespace bonsai
+} // namespace ocs
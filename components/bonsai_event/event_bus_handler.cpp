@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <memory>
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_event/event_bus_handler.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+EventBusHandler::EventBusHandler(EventBus& bus)
+    : bus_(bus) {
+}
+
+status::StatusCode EventBusHandler::handle(httpd_req_t* req) {
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = format_(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+status::StatusCode EventBusHandler::format_(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_number_cs("published_count", bus_.get_published_count())) {
+        return status::StatusCode::NoMem;
+    }
+
+    cJSON* array = cJSON_AddArrayToObject(json, "subscribers");
+    if (!array) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (unsigned n = 0; n < bus_.get_subscriber_count(); ++n) {
+        const auto& subscriber = bus_.get_subscriber(n);
+
+        cJSON* item = cJSON_CreateObject();
+        if (!item) {
+            return status::StatusCode::NoMem;
+        }
+
+        cJSON_AddItemToArray(array, item);
+
+        fmt::json::CjsonObjectFormatter item_formatter(item);
+
+        if (!item_formatter.add_string_ref_cs("id", subscriber.get_id())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!item_formatter.add_number_cs("capacity", subscriber.get_capacity())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!item_formatter.add_number_cs("pending_count",
+                                          subscriber.get_pending_count())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!item_formatter.add_number_cs("delivered_count",
+                                          subscriber.get_delivered_count())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!item_formatter.add_number_cs("drop_count", subscriber.get_drop_count())) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_event/event_bus.h"
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Report the number of published events and the per-subscriber queue statistics.
+class EventBusHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit EventBusHandler(EventBus& bus);
+
+    //! Send the event bus statistics as JSON.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    status::StatusCode format_(cJSON* json);
+
+    EventBus& bus_;
+};
+
+} // namespace bonsai
+} // namespace ocs
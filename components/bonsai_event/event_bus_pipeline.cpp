@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_event/event_bus_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+EventBusPipeline::EventBusPipeline(core::IClock& clock, http::IRouter& router)
+    : clock_(clock) {
+#ifdef CONFIG_BONSAI_FIRMWARE_EVENT_BUS_ENABLE
+    bus_.reset(new (std::nothrow) EventBus());
+    configASSERT(bus_);
+
+    handler_.reset(new (std::nothrow) EventBusHandler(*bus_));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/event_bus",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_EVENT_BUS_ENABLE
+}
+
+void EventBusPipeline::add(sensor::soil::AnalogSensor& sensor,
+                           const char* id,
+                           SensorTaskScheduler& scheduler) {
+    if (!bus_) {
+        return;
+    }
+
+    add_(std::unique_ptr<SensorEventSource>(
+             new (std::nothrow) SoilAnalogEventSource(clock_, *bus_, sensor, id)),
+         scheduler);
+}
+
+void EventBusPipeline::add(sensor::ldr::AnalogSensor& sensor,
+                           const char* id,
+                           SensorTaskScheduler& scheduler) {
+    if (!bus_) {
+        return;
+    }
+
+    add_(std::unique_ptr<SensorEventSource>(
+             new (std::nothrow) LdrAnalogEventSource(clock_, *bus_, sensor, id)),
+         scheduler);
+}
+
+void EventBusPipeline::add(sensor::ds18b20::Sensor& sensor,
+                           const char* id,
+                           SensorTaskScheduler& scheduler) {
+    if (!bus_) {
+        return;
+    }
+
+    add_(std::unique_ptr<SensorEventSource>(
+             new (std::nothrow) DS18B20EventSource(clock_, *bus_, sensor, id)),
+         scheduler);
+}
+
+void EventBusPipeline::add(sensor::sht41::Sensor& sensor,
+                           const char* id,
+                           SensorTaskScheduler& scheduler) {
+    if (!bus_) {
+        return;
+    }
+
+    add_(std::unique_ptr<SensorEventSource>(
+             new (std::nothrow) SHT41EventSource(clock_, *bus_, sensor, id)),
+         scheduler);
+}
+
+EventBus::Subscriber* EventBusPipeline::subscribe(const char* id,
+                                                  EventBus::Filter filter) {
+#ifdef CONFIG_BONSAI_FIRMWARE_EVENT_BUS_ENABLE
+    return &bus_->subscribe(id, filter, CONFIG_BONSAI_FIRMWARE_EVENT_BUS_QUEUE_CAPACITY);
+#else
+    (void)id;
+    (void)filter;
+
+    return nullptr;
+#endif // CONFIG_BONSAI_FIRMWARE_EVENT_BUS_ENABLE
+}
+
+void EventBusPipeline::add_(std::unique_ptr<SensorEventSource> source,
+                            SensorTaskScheduler& scheduler) {
+    configASSERT(source);
+
+    scheduler.add_handler(*source);
+
+    sources_.push_back(std::move(source));
+}
+
+} // namespace bonsai
+} // namespace ocs
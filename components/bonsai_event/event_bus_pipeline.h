@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_http/irouter.h"
+
+#include "bonsai_event/event_bus.h"
+#include "bonsai_event/event_bus_handler.h"
+#include "bonsai_event/sensor_event_source.h"
+#include "bonsai_sensor/sensor_task_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Publish the sensor readings on the event bus.
+//!
+//! @remarks
+//!  Each reading of the added sensor is published from the sensor read task, see
+//!  SensorTaskScheduler, and delivered to all matching subscribers. The bus
+//!  statistics are available via GET /api/v1/diagnostic/event_bus.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_EVENT_BUS_ENABLE is disabled, no events are published.
+class EventBusPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    EventBusPipeline(core::IClock& clock, http::IRouter& router);
+
+    //! Publish readings of the soil sensor read via @p scheduler.
+    void add(sensor::soil::AnalogSensor& sensor,
+             const char* id,
+             SensorTaskScheduler& scheduler);
+
+    //! Publish readings of the LDR sensor read via @p scheduler.
+    void add(sensor::ldr::AnalogSensor& sensor,
+             const char* id,
+             SensorTaskScheduler& scheduler);
+
+    //! Publish readings of the DS18B20 sensor read via @p scheduler.
+    void add(sensor::ds18b20::Sensor& sensor,
+             const char* id,
+             SensorTaskScheduler& scheduler);
+
+    //! Publish readings of the SHT41 sensor read via @p scheduler.
+    void add(sensor::sht41::Sensor& sensor,
+             const char* id,
+             SensorTaskScheduler& scheduler);
+
+    //! Register a new subscriber.
+    //!
+    //! @return
+    //!  nullptr if the event bus is disabled.
+    //!
+    //! @notes
+    //!  Should be called before the task scheduler is started.
+    EventBus::Subscriber* subscribe(const char* id, EventBus::Filter filter);
+
+private:
+    void add_(std::unique_ptr<SensorEventSource> source, SensorTaskScheduler& scheduler);
+
+    core::IClock& clock_;
+
+    std::unique_ptr<EventBus> bus_;
+    std::unique_ptr<EventBusHandler> handler_;
+
+    std::vector<std::unique_ptr<SensorEventSource>> sources_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_event/sensor_event.h"
+
+namespace ocs {
+namespace bonsai {
+
+const char* sensor_type_to_str(SensorType type) {
+    switch (type) {
+    case SensorType::SoilAnalog:
+        return "soil_analog";
+    case SensorType::LdrAnalog:
+        return "ldr_analog";
+    case SensorType::DS18B20:
+        return "ds18b20";
+    case SensorType::SHT41:
+        return "sht41";
+    default:
+        break;
+    }
+
+    return "<none>";
+}
+
+} // namespace bonsai
+} // namespace ocs
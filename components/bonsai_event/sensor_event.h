@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "ocs_core/time.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Type of the sensor which produced the event.
+enum class SensorType : uint8_t {
+    SoilAnalog,
+    LdrAnalog,
+    DS18B20,
+    SHT41,
+    Last,
+};
+
+//! Return the human-readable sensor type.
+const char* sensor_type_to_str(SensorType type);
+
+//! Sensor reading published on the event bus.
+struct SensorEvent {
+    //! Soil moisture reading.
+    struct Soil {
+        //! Moisture, in percents.
+        float moisture { 0 };
+
+        //! Current soil status, see sensor::soil::SoilStatus.
+        uint8_t status { 0 };
+    };
+
+    //! Lightness reading.
+    struct Ldr {
+        //! Lightness, in percents.
+        float lightness { 0 };
+    };
+
+    //! Temperature reading.
+    struct Temperature {
+        //! Temperature, in degrees Celsius.
+        float temperature { 0 };
+    };
+
+    //! Temperature and relative humidity reading.
+    struct Climate {
+        //! Temperature, in degrees Celsius.
+        float temperature { 0 };
+
+        //! Relative humidity, in percents.
+        float humidity { 0 };
+    };
+
+    //! Sensor identifier, valid during the program lifetime.
+    const char* sensor_id { nullptr };
+
+    //! Sensor type, defines which reading is valid.
+    SensorType type { SensorType::Last };
+
+    //! Time when the sensor was read.
+    core::Time timestamp { 0 };
+
+    union {
+        //! Valid if the type is SensorType::SoilAnalog.
+        Soil soil;
+
+        //! Valid if the type is SensorType::LdrAnalog.
+        Ldr ldr;
+
+        //! Valid if the type is SensorType::DS18B20.
+        Temperature temperature;
+
+        //! Valid if the type is SensorType::SHT41.
+        Climate climate;
+    };
+
+    SensorEvent()
+        : climate() {
+    }
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_event/sensor_event_source.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorEventSource::SensorEventSource(core::IClock& clock,
+                                     EventBus& bus,
+                                     const char* id,
+                                     SensorType type)
+    : clock_(clock)
+    , bus_(bus)
+    , id_(id)
+    , type_(type) {
+}
+
+void SensorEventSource::handle_read(status::StatusCode code) {
+    if (code != status::StatusCode::OK) {
+        return;
+    }
+
+    SensorEvent event;
+    event.sensor_id = id_;
+    event.type = type_;
+    event.timestamp = clock_.now();
+
+    read_(event);
+    bus_.publish(event);
+}
+
+SoilAnalogEventSource::SoilAnalogEventSource(core::IClock& clock,
+                                             EventBus& bus,
+                                             sensor::soil::AnalogSensor& sensor,
+                                             const char* id)
+    : SensorEventSource(clock, bus, id, SensorType::SoilAnalog)
+    , sensor_(sensor) {
+}
+
+void SoilAnalogEventSource::read_(SensorEvent& event) {
+    const auto data = sensor_.get_data();
+
+    event.soil.moisture = data.moisture;
+    event.soil.status = static_cast<uint8_t>(data.curr_status);
+}
+
+LdrAnalogEventSource::LdrAnalogEventSource(core::IClock& clock,
+                                           EventBus& bus,
+                                           sensor::ldr::AnalogSensor& sensor,
+                                           const char* id)
+    : SensorEventSource(clock, bus, id, SensorType::LdrAnalog)
+    , sensor_(sensor) {
+}
+
+void LdrAnalogEventSource::read_(SensorEvent& event) {
+    event.ldr.lightness = sensor_.get_data().lightness;
+}
+
+DS18B20EventSource::DS18B20EventSource(core::IClock& clock,
+                                       EventBus& bus,
+                                       sensor::ds18b20::Sensor& sensor,
+                                       const char* id)
+    : SensorEventSource(clock, bus, id, SensorType::DS18B20)
+    , sensor_(sensor) {
+}
+
+void DS18B20EventSource::read_(SensorEvent& event) {
+    event.temperature.temperature = sensor_.get_data().temperature;
+}
+
+SHT41EventSource::SHT41EventSource(core::IClock& clock,
+                                   EventBus& bus,
+                                   sensor::sht41::Sensor& sensor,
+                                   const char* id)
+    : SensorEventSource(clock, bus, id, SensorType::SHT41)
+    , sensor_(sensor) {
+}
+
+void SHT41EventSource::read_(SensorEvent& event) {
+    const auto data = sensor_.get_data();
+
+    event.climate.temperature = data.temperature;
+    event.climate.humidity = data.humidity;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_sensor/ds18b20/sensor.h"
+#include "ocs_sensor/ldr/analog_sensor.h"
+#include "ocs_sensor/sht41/sensor.h"
+#include "ocs_sensor/soil/analog_sensor.h"
+
+#include "bonsai_event/event_bus.h"
+#include "bonsai_sensor/iread_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Publish each sensor reading to the event bus.
+//!
+//! @remarks
+//!  The source is notified from the sensor read task, see SensorTaskScheduler, so an
+//!  event is published only when the sensor data is actually updated.
+class SensorEventSource : public IReadHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p clock to timestamp the events.
+    //!  - @p bus to publish the events to.
+    //!  - @p id - sensor identifier, should be valid during the source lifetime.
+    //!  - @p type - sensor type.
+    SensorEventSource(core::IClock& clock,
+                      EventBus& bus,
+                      const char* id,
+                      SensorType type);
+
+    //! Publish the reading if the sensor was read successfully.
+    void handle_read(status::StatusCode code) override;
+
+protected:
+    //! Fill the type-specific reading of @p event.
+    virtual void read_(SensorEvent& event) = 0;
+
+private:
+    core::IClock& clock_;
+    EventBus& bus_;
+
+    const char* id_ { nullptr };
+    const SensorType type_ { SensorType::Last };
+};
+
+//! Publish the soil analog sensor readings.
+class SoilAnalogEventSource : public SensorEventSource {
+public:
+    //! Initialize.
+    SoilAnalogEventSource(core::IClock& clock,
+                          EventBus& bus,
+                          sensor::soil::AnalogSensor& sensor,
+                          const char* id);
+
+private:
+    void read_(SensorEvent& event) override;
+
+    sensor::soil::AnalogSensor& sensor_;
+};
+
+//! Publish the LDR analog sensor readings.
+class LdrAnalogEventSource : public SensorEventSource {
+public:
+    //! Initialize.
+    LdrAnalogEventSource(core::IClock& clock,
+                         EventBus& bus,
+                         sensor::ldr::AnalogSensor& sensor,
+                         const char* id);
+
+private:
+    void read_(SensorEvent& event) override;
+
+    sensor::ldr::AnalogSensor& sensor_;
+};
+
+//! Publish the DS18B20 sensor readings.
+class DS18B20EventSource : public SensorEventSource {
+public:
+    //! Initialize.
+    DS18B20EventSource(core::IClock& clock,
+                       EventBus& bus,
+                       sensor::ds18b20::Sensor& sensor,
+                       const char* id);
+
+private:
+    void read_(SensorEvent& event) override;
+
+    sensor::ds18b20::Sensor& sensor_;
+};
+
+//! Publish the SHT41 sensor readings.
+class SHT41EventSource : public SensorEventSource {
+public:
+    //! Initialize.
+    SHT41EventSource(core::IClock& clock,
+                     EventBus& bus,
+                     sensor::sht41::Sensor& sensor,
+                     const char* id);
+
+private:
+    void read_(SensorEvent& event) override;
+
+    sensor::sht41::Sensor& sensor_;
+};
+
+} // namespace bonsai
+} // namespace ocs
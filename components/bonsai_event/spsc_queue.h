@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Fixed-capacity lock-free queue with a single producer and a single consumer.
+//!
+//! @remarks
+//!  push() and pop() never block, push() fails if the queue is full.
+template <typename T> class SpscQueue : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p capacity - maximum number of the queued elements.
+    explicit SpscQueue(unsigned capacity)
+        : capacity_(capacity) {
+        configASSERT(capacity_);
+
+        buf_.reset(new (std::nothrow) T[capacity_]);
+        configASSERT(buf_);
+    }
+
+    //! Add @p value to the end of the queue.
+    //!
+    //! @return
+    //!  false if the queue is full.
+    //!
+    //! @notes
+    //!  Should be called only by the producer.
+    bool push(const T& value) {
+        const unsigned tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == capacity_) {
+            return false;
+        }
+
+        buf_[tail % capacity_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! Remove the first element from the queue and store it in @p value.
+    //!
+    //! @return
+    //!  false if the queue is empty.
+    //!
+    //! @notes
+    //!  Should be called only by the consumer.
+    bool pop(T& value) {
+        const unsigned head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        value = buf_[head % capacity_];
+        head_.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! Return the number of the queued elements.
+    unsigned get_size() const {
+        return tail_.load(std::memory_order_acquire)
+            - head_.load(std::memory_order_acquire);
+    }
+
+    //! Return the maximum number of the queued elements.
+    unsigned get_capacity() const {
+        return capacity_;
+    }
+
+private:
+    const unsigned capacity_ { 0 };
+
+    std::unique_ptr<T[]> buf_;
+
+    std::atomic<unsigned> head_ { 0 };
+    std::atomic<unsigned> tail_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
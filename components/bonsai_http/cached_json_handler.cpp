@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_status/macros.h"
+
+#include "bonsai_http/cached_json_handler.h"
+#include "bonsai_http/chunked_json_writer.h"
+#include "bonsai_http/http_chunk_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+CachedJsonHandler::CachedJsonHandler(fmt::json::IFormatter& static_formatter,
+                                     fmt::json::IFormatter& dynamic_formatter,
+                                     size_t chunk_size)
+    : static_formatter_(static_formatter)
+    , dynamic_formatter_(dynamic_formatter)
+    , chunk_size_(chunk_size) {
+    chunk_.reset(new (std::nothrow) char[chunk_size_]);
+    configASSERT(chunk_);
+}
+
+void CachedJsonHandler::invalidate() {
+    valid_ = false;
+}
+
+status::StatusCode CachedJsonHandler::handle(httpd_req_t* req) {
+    JsonPtr dynamic_json(cJSON_CreateObject(), cJSON_Delete);
+    if (!dynamic_json) {
+        return status::StatusCode::NoMem;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(dynamic_formatter_.format(dynamic_json.get()));
+
+    // The flag is cleared before the static part is formatted, so the invalidation
+    // which happens in the meantime isn't lost.
+    if (!valid_.exchange(true)) {
+        const auto code = update_(dynamic_json.get());
+        if (code != status::StatusCode::OK) {
+            valid_ = false;
+            return code;
+        }
+    }
+
+    if (httpd_resp_set_type(req, HTTPD_TYPE_JSON) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    HttpChunkWriter chunk_writer(req);
+
+    // Cached text without the closing brace.
+    OCS_STATUS_RETURN_ON_ERROR(chunk_writer.write(text_.get(), text_size_ - 1));
+
+    if (dynamic_json->child) {
+        if (text_size_ > strlen("{}")) {
+            OCS_STATUS_RETURN_ON_ERROR(chunk_writer.write(",", 1));
+        }
+
+        ChunkedJsonWriter json_writer(chunk_writer, chunk_.get(), chunk_size_);
+        OCS_STATUS_RETURN_ON_ERROR(json_writer.write_fields(dynamic_json.get()));
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(chunk_writer.write("}", 1));
+
+    return chunk_writer.finish();
+}
+
+void CachedJsonHandler::free_text_(char* text) {
+    cJSON_free(text);
+}
+
+status::StatusCode CachedJsonHandler::update_(const cJSON* dynamic_json) {
+    JsonPtr static_json(cJSON_CreateObject(), cJSON_Delete);
+    if (!static_json) {
+        return status::StatusCode::NoMem;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(static_formatter_.format(static_json.get()));
+
+    for (const cJSON* item = dynamic_json->child; item; item = item->next) {
+        cJSON_DeleteItemFromObjectCaseSensitive(static_json.get(), item->string);
+    }
+
+    text_.reset(cJSON_PrintUnformatted(static_json.get()));
+    if (!text_) {
+        text_size_ = 0;
+        return status::StatusCode::NoMem;
+    }
+
+    text_size_ = strlen(text_.get());
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the JSON object, which rarely changes, without formatting it on each request.
+//!
+//! @remarks
+//!  The object is split into two parts:
+//!   - static part is formatted and serialized once, and the cached text is sent
+//!     until the cache is invalidated.
+//!   - dynamic part is formatted on each request and appended to the cached text.
+//!     Its fields are removed from the static part, so the stale values are never
+//!     sent.
+class CachedJsonHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p static_formatter to format the static part.
+    //!  - @p dynamic_formatter to format the dynamic part.
+    //!  - @p chunk_size - size of the chunk buffer for the dynamic part, in bytes.
+    CachedJsonHandler(fmt::json::IFormatter& static_formatter,
+                      fmt::json::IFormatter& dynamic_formatter,
+                      size_t chunk_size);
+
+    //! Format the static part again on the next request.
+    //!
+    //! @notes
+    //!  Can be called from any task.
+    void invalidate();
+
+    //! Send the cached static part and the formatted dynamic part.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+    static void free_text_(char* text);
+
+    status::StatusCode update_(const cJSON* dynamic_json);
+
+    fmt::json::IFormatter& static_formatter_;
+    fmt::json::IFormatter& dynamic_formatter_;
+
+    const size_t chunk_size_ { 0 };
+    std::unique_ptr<char[]> chunk_;
+
+    std::atomic<bool> valid_ { false };
+
+    std::unique_ptr<char, decltype(&free_text_)> text_ { nullptr, &free_text_ };
+    size_t text_size_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
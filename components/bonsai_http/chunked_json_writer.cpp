@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_status/macros.h"
+
+#include "bonsai_http/chunked_json_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+ChunkedJsonWriter::ChunkedJsonWriter(IChunkWriter& writer, char* buf, size_t size)
+    : writer_(writer)
+    , buf_(buf)
+    , size_(size) {
+    configASSERT(buf_);
+    configASSERT(size_);
+}
+
+status::StatusCode ChunkedJsonWriter::write(const cJSON* json) {
+    OCS_STATUS_RETURN_ON_ERROR(write_item_(json));
+
+    return flush_();
+}
+
+status::StatusCode ChunkedJsonWriter::write_fields(const cJSON* json) {
+    if (!json || (json->type & 0xFF) != cJSON_Object) {
+        return status::StatusCode::InvalidArg;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(write_fields_(json));
+
+    return flush_();
+}
+
+status::StatusCode ChunkedJsonWriter::write_item_(const cJSON* item) {
+    if (!item) {
+        return status::StatusCode::InvalidArg;
+    }
+
+    switch (item->type & 0xFF) {
+    case cJSON_NULL:
+        return write_str_("null");
+
+    case cJSON_False:
+        return write_str_("false");
+
+    case cJSON_True:
+        return write_str_("true");
+
+    case cJSON_Number:
+        return write_number_(item->valuedouble);
+
+    case cJSON_String:
+        return write_string_(item->valuestring);
+
+    case cJSON_Raw:
+        if (!item->valuestring) {
+            return status::StatusCode::InvalidArg;
+        }
+        return write_str_(item->valuestring);
+
+    case cJSON_Array:
+        OCS_STATUS_RETURN_ON_ERROR(write_char_('['));
+
+        for (const cJSON* child = item->child; child; child = child->next) {
+            OCS_STATUS_RETURN_ON_ERROR(write_item_(child));
+
+            if (child->next) {
+                OCS_STATUS_RETURN_ON_ERROR(write_char_(','));
+            }
+        }
+
+        return write_char_(']');
+
+    case cJSON_Object:
+        OCS_STATUS_RETURN_ON_ERROR(write_char_('{'));
+        OCS_STATUS_RETURN_ON_ERROR(write_fields_(item));
+
+        return write_char_('}');
+
+    default:
+        break;
+    }
+
+    return status::StatusCode::InvalidArg;
+}
+
+status::StatusCode ChunkedJsonWriter::write_fields_(const cJSON* item) {
+    for (const cJSON* child = item->child; child; child = child->next) {
+        OCS_STATUS_RETURN_ON_ERROR(write_string_(child->string));
+        OCS_STATUS_RETURN_ON_ERROR(write_char_(':'));
+        OCS_STATUS_RETURN_ON_ERROR(write_item_(child));
+
+        if (child->next) {
+            OCS_STATUS_RETURN_ON_ERROR(write_char_(','));
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode ChunkedJsonWriter::write_number_(double value) {
+    // Same rules as cJSON uses to print numbers.
+    char str[26];
+
+    if (std::isnan(value) || std::isinf(value)) {
+        return write_str_("null");
+    }
+
+    if (value >= INT_MIN && value <= INT_MAX
+        && value == static_cast<double>(static_cast<int>(value))) {
+        snprintf(str, sizeof(str), "%d", static_cast<int>(value));
+    } else {
+        snprintf(str, sizeof(str), "%1.15g", value);
+
+        if (strtod(str, nullptr) != value) {
+            snprintf(str, sizeof(str), "%1.17g", value);
+        }
+    }
+
+    return write_str_(str);
+}
+
+status::StatusCode ChunkedJsonWriter::write_string_(const char* str) {
+    if (!str) {
+        return write_str_("\"\"");
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(write_char_('"'));
+
+    for (const unsigned char* p = reinterpret_cast<const unsigned char*>(str); *p; ++p) {
+        switch (*p) {
+        case '"':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\\""));
+            break;
+        case '\\':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\\\"));
+            break;
+        case '\b':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\b"));
+            break;
+        case '\f':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\f"));
+            break;
+        case '\n':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\n"));
+            break;
+        case '\r':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\r"));
+            break;
+        case '\t':
+            OCS_STATUS_RETURN_ON_ERROR(write_str_("\\t"));
+            break;
+        default:
+            if (*p < 32) {
+                char escaped[7];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", *p);
+                OCS_STATUS_RETURN_ON_ERROR(write_str_(escaped));
+            } else {
+                OCS_STATUS_RETURN_ON_ERROR(write_char_(*p));
+            }
+            break;
+        }
+    }
+
+    return write_char_('"');
+}
+
+status::StatusCode ChunkedJsonWriter::write_str_(const char* str) {
+    for (; *str; ++str) {
+        OCS_STATUS_RETURN_ON_ERROR(write_char_(*str));
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode ChunkedJsonWriter::write_char_(char c) {
+    if (pos_ == size_) {
+        OCS_STATUS_RETURN_ON_ERROR(flush_());
+    }
+
+    buf_[pos_++] = c;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode ChunkedJsonWriter::flush_() {
+    if (!pos_) {
+        return status::StatusCode::OK;
+    }
+
+    const auto code = writer_.write(buf_, pos_);
+    pos_ = 0;
+
+    return code;
+}
+
+} // namespace bonsai
+} // namespace ocs
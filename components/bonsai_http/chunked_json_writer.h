@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_http/ichunk_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Serialize the cJSON tree in fixed-size chunks.
+//!
+//! @remarks
+//!  The JSON text is never built in memory as a whole: once the chunk buffer is
+//!  full it's passed to the underlying writer and reused. The output is the same
+//!  as cJSON_PrintUnformatted() produces.
+class ChunkedJsonWriter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p writer to pass the serialized chunks to.
+    //!  - @p buf - chunk buffer.
+    //!  - @p size - chunk buffer size, in bytes.
+    ChunkedJsonWriter(IChunkWriter& writer, char* buf, size_t size);
+
+    //! Serialize @p json and flush the remaining data.
+    status::StatusCode write(const cJSON* json);
+
+    //! Serialize the fields of @p json object, without the enclosing braces, and
+    //! flush the remaining data.
+    status::StatusCode write_fields(const cJSON* json);
+
+private:
+    status::StatusCode write_item_(const cJSON* item);
+    status::StatusCode write_fields_(const cJSON* item);
+    status::StatusCode write_number_(double value);
+    status::StatusCode write_string_(const char* str);
+    status::StatusCode write_str_(const char* str);
+    status::StatusCode write_char_(char c);
+    status::StatusCode flush_();
+
+    IChunkWriter& writer_;
+
+    char* const buf_ { nullptr };
+    const size_t size_ { 0 };
+
+    size_t pos_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
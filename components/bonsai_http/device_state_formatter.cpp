@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_http/device_state_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+DeviceStateFormatter::DeviceStateFormatter(time_t start_point)
+    : start_point_(start_point) {
+}
+
+status::StatusCode DeviceStateFormatter::format(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_number_cs("uptime", esp_timer_get_time() / 1000000)) {
+        return status::StatusCode::NoMem;
+    }
+
+    time_t timestamp = time(nullptr);
+    if (timestamp < start_point_) {
+        timestamp = -1;
+    }
+
+    if (!formatter.add_number_cs("timestamp", timestamp)) {
+        return status::StatusCode::NoMem;
+    }
+
+    wifi_ap_record_t record;
+    if (esp_wifi_sta_get_ap_info(&record) == ESP_OK) {
+        if (!formatter.add_number_cs("rssi", record.rssi)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
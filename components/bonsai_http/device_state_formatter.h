@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <ctime>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the frequently changing device state: uptime, WiFi RSSI and local time.
+class DeviceStateFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p start_point - UNIX time since which the local time is considered valid.
+    explicit DeviceStateFormatter(time_t start_point);
+
+    //! Format the device state.
+    //!
+    //! @remarks
+    //!  The timestamp is -1 if the local time isn't synchronized yet, RSSI is
+    //!  omitted if the device isn't connected to the AP.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    const time_t start_point_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
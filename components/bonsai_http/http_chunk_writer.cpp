@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_http/http_chunk_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+HttpChunkWriter::HttpChunkWriter(httpd_req_t* req)
+    : req_(req) {
+    configASSERT(req_);
+}
+
+status::StatusCode HttpChunkWriter::write(const char* data, size_t size) {
+    if (httpd_resp_send_chunk(req_, data, size) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode HttpChunkWriter::finish() {
+    return write(nullptr, 0);
+}
+
+} // namespace bonsai
+} // namespace ocs
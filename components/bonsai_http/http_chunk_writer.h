@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "esp_http_server.h"
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_http/ichunk_writer.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the data as HTTP chunks.
+class HttpChunkWriter : public IChunkWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit HttpChunkWriter(httpd_req_t* req);
+
+    //! Send @p data as a single HTTP chunk.
+    status::StatusCode write(const char* data, size_t size) override;
+
+    //! Send the terminating chunk.
+    status::StatusCode finish();
+
+private:
+    httpd_req_t* req_ { nullptr };
+};
+
+} // namespace bonsai
+} // namespace ocs
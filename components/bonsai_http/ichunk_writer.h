@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Sink for the serialized data.
+class IChunkWriter {
+public:
+    //! Destroy.
+    virtual ~IChunkWriter() = default;
+
+    //! Write @p size bytes of @p data.
+    virtual status::StatusCode write(const char* data, size_t size) = 0;
+};
+
+} // namespace bonsai
+} // namespace ocs
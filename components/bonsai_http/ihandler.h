@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "esp_http_server.h"
+
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! HTTP request handler.
+class IHandler {
+public:
+    //! Destroy.
+    virtual ~IHandler() = default;
+
+    //! Handle HTTP request.
+    //!
+    //! @remarks
+    //!  The handler is responsible for sending the response, including the client
+    //!  errors. If an error is returned, the connection is closed.
+    virtual status::StatusCode handle(httpd_req_t* req) = 0;
+};
+
+} // namespace bonsai
+} // namespace ocs
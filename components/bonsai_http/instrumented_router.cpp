@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <utility>
+
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/alloc_tracker.h"
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_core/tracer.h"
+#include "bonsai_http/instrumented_router.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "instrumented_router";
+
+} // namespace
+
+InstrumentedRouter::InstrumentedRouter(http::IRouter& router)
+    : router_(router) {
+}
+
+void InstrumentedRouter::add(Method method, const char* path, HandlerFunc func) {
+    router_.add(method, path,
+                [path, func = std::move(func)](httpd_req_t* req) -> status::StatusCode {
+                    AllocScope alloc_scope(AllocDomain::Http);
+                    TraceScope trace_scope("http", path);
+
+                    const auto code = func(req);
+                    if (code != status::StatusCode::OK) {
+                        bonsai_logw(log_tag, "failed to handle request: uri=%s code=%s",
+                                    req->uri, status::code_to_str(code));
+                    }
+
+                    return code;
+                });
+}
+
+} // namespace bonsai
+} // namespace ocs
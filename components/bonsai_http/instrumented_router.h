@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Register the HTTP handlers in the underlying router, accounting the request
+//! handling.
+//!
+//! @remarks
+//!  Allocations made by the handlers are accounted to AllocDomain::Http, the handling
+//!  is recorded by the tracer, and the failed requests are logged.
+class InstrumentedRouter : public http::IRouter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit InstrumentedRouter(http::IRouter& router);
+
+    //! Register @p func in the underlying router.
+    //!
+    //! @notes
+    //!  @p path should be valid during the router lifetime.
+    void add(Method method, const char* path, HandlerFunc func) override;
+
+private:
+    http::IRouter& router_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_status/macros.h"
+
+#include "bonsai_http/chunked_json_writer.h"
+#include "bonsai_http/http_chunk_writer.h"
+#include "bonsai_http/json_stream_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+JsonStreamHandler::JsonStreamHandler(fmt::json::IFormatter& formatter, size_t chunk_size)
+    : formatter_(formatter)
+    , chunk_size_(chunk_size) {
+    chunk_.reset(new (std::nothrow) char[chunk_size_]);
+    configASSERT(chunk_);
+}
+
+status::StatusCode JsonStreamHandler::handle(httpd_req_t* req) {
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(formatter_.format(json.get()));
+
+    if (httpd_resp_set_type(req, HTTPD_TYPE_JSON) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    HttpChunkWriter chunk_writer(req);
+    ChunkedJsonWriter json_writer(chunk_writer, chunk_.get(), chunk_size_);
+
+    OCS_STATUS_RETURN_ON_ERROR(json_writer.write(json.get()));
+
+    return chunk_writer.finish();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_http/ihandler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the formatted JSON data with HTTP chunked encoding.
+//!
+//! @remarks
+//!  The response size isn't limited by the buffer size, the JSON text is serialized
+//!  into a small chunk buffer which is sent and reused. The buffer is shared between
+//!  the requests, since the HTTP server handles requests one at a time.
+class JsonStreamHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p formatter to format the JSON data.
+    //!  - @p chunk_size - size of the chunk buffer, in bytes.
+    JsonStreamHandler(fmt::json::IFormatter& formatter, size_t chunk_size);
+
+    //! Format and send the JSON data.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    fmt::json::IFormatter& formatter_;
+
+    const size_t chunk_size_ { 0 };
+    std::unique_ptr<char[]> chunk_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_http/json_stream_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+JsonStreamPipeline::JsonStreamPipeline(http::IRouter& router,
+                                       net::FanoutNetworkHandler& network_handler,
+                                       fmt::json::IFormatter& telemetry_formatter,
+                                       fmt::json::IFormatter& registration_formatter,
+                                       time_t start_point) {
+    router_.reset(new (std::nothrow) OverrideRouter(router));
+    configASSERT(router_);
+
+    router_->override(http::IRouter::Method::Get, telemetry_path_);
+    router_->override(http::IRouter::Method::Get, registration_path_);
+
+    telemetry_handler_.reset(new (std::nothrow) JsonStreamHandler(
+        telemetry_formatter, CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(telemetry_handler_);
+
+    router.add(http::IRouter::Method::Get, telemetry_path_, [this](httpd_req_t* req) {
+        return telemetry_handler_->handle(req);
+    });
+
+    device_state_formatter_.reset(new (std::nothrow) DeviceStateFormatter(start_point));
+    configASSERT(device_state_formatter_);
+
+    dynamic_registration_formatter_.reset(new (std::nothrow)
+                                              fmt::json::FanoutFormatter());
+    configASSERT(dynamic_registration_formatter_);
+
+    dynamic_registration_formatter_->add(*device_state_formatter_);
+
+    registration_handler_.reset(new (std::nothrow) CachedJsonHandler(
+        registration_formatter, *dynamic_registration_formatter_,
+        CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(registration_handler_);
+
+    router.add(http::IRouter::Method::Get, registration_path_, [this](httpd_req_t* req) {
+        return registration_handler_->handle(req);
+    });
+
+    network_handler.add(*this);
+}
+
+http::IRouter& JsonStreamPipeline::get_router() {
+    return *router_;
+}
+
+fmt::json::FanoutFormatter& JsonStreamPipeline::get_dynamic_registration_formatter() {
+    return *dynamic_registration_formatter_;
+}
+
+void JsonStreamPipeline::handle_connect() {
+    registration_handler_->invalidate();
+}
+
+void JsonStreamPipeline::handle_disconnect() {
+    registration_handler_->invalidate();
+}
+
+} // namespace bonsai
+} // namespace ocs
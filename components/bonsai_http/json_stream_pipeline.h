@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_http/irouter.h"
+#include "ocs_net/fanout_network_handler.h"
+#include "ocs_net/inetwork_handler.h"
+
+#include "bonsai_http/cached_json_handler.h"
+#include "bonsai_http/device_state_formatter.h"
+#include "bonsai_http/json_stream_handler.h"
+#include "bonsai_http/override_router.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Serve the telemetry and registration data with HTTP chunked encoding.
+//!
+//! @remarks
+//!  Endpoints:
+//!   - GET /api/v1/telemetry
+//!   - GET /api/v1/registration
+//!
+//!  The endpoints replace the ones of HttpPipeline, which format the data into the
+//!  fixed-size buffers and truncate it, see get_router().
+//!
+//!  The registration data is serialized once and cached until the next network
+//!  event, only the dynamic fields are formatted on each request, see
+//!  CachedJsonHandler.
+class JsonStreamPipeline : private net::INetworkHandler, public core::NonCopyable<> {
+public:
+    //! Buffer size for the telemetry and registration handlers of HttpPipeline.
+    //!
+    //! @remarks
+    //!  The handlers are never called, since their routes are overridden, so their
+    //!  buffers are kept minimal.
+    static constexpr unsigned upstream_buffer_size = 1;
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p router to register the endpoints.
+    //!  - @p network_handler to invalidate the registration data on network events.
+    //!  - @p telemetry_formatter to format the telemetry data.
+    //!  - @p registration_formatter to format the static registration data.
+    //!  - @p start_point - UNIX time since which the local time is considered valid.
+    JsonStreamPipeline(http::IRouter& router,
+                       net::FanoutNetworkHandler& network_handler,
+                       fmt::json::IFormatter& telemetry_formatter,
+                       fmt::json::IFormatter& registration_formatter,
+                       time_t start_point);
+
+    //! Return the router which skips the telemetry and registration handlers.
+    //!
+    //! @notes
+    //!  HttpPipeline should register its handlers via this router.
+    http::IRouter& get_router();
+
+    //! Return the formatter for the registration fields which change between the
+    //! network events.
+    fmt::json::FanoutFormatter& get_dynamic_registration_formatter();
+
+private:
+    void handle_connect() override;
+    void handle_disconnect() override;
+
+    static constexpr const char* telemetry_path_ = "/api/v1/telemetry";
+    static constexpr const char* registration_path_ = "/api/v1/registration";
+
+    std::unique_ptr<OverrideRouter> router_;
+    std::unique_ptr<JsonStreamHandler> telemetry_handler_;
+
+    std::unique_ptr<DeviceStateFormatter> device_state_formatter_;
+    std::unique_ptr<fmt::json::FanoutFormatter> dynamic_registration_formatter_;
+    std::unique_ptr<CachedJsonHandler> registration_handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <utility>
+
+#include "ocs_core/log.h"
+
+#include "bonsai_http/override_router.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "override_router";
+
+} // namespace
+
+OverrideRouter::OverrideRouter(http::IRouter& router)
+    : router_(router) {
+}
+
+void OverrideRouter::override(Method method, const char* path) {
+    routes_.push_back(Route {
+        .method = method,
+        .path = path,
+    });
+}
+
+void OverrideRouter::add(Method method, const char* path, HandlerFunc func) {
+    for (const auto& route : routes_) {
+        if (route.method == method && strcmp(route.path, path) == 0) {
+            ocs_logi(log_tag, "handler overridden: path=%s", path);
+            return;
+        }
+    }
+
+    router_.add(method, path, std::move(func));
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Register the HTTP handlers in the underlying router, except the overridden ones.
+//!
+//! @remarks
+//!  Allows to replace the handlers registered by the upstream pipelines, e.g. the
+//!  telemetry and registration handlers of HttpPipeline, which format the data into
+//!  the fixed-size buffers, with the streaming ones.
+class OverrideRouter : public http::IRouter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit OverrideRouter(http::IRouter& router);
+
+    //! Skip the handlers of @p method requests to @p path.
+    //!
+    //! @notes
+    //!  @p path should be valid during the router lifetime.
+    void override(Method method, const char* path);
+
+    //! Register @p func in the underlying router, if the route isn't overridden.
+    void add(Method method, const char* path, HandlerFunc func) override;
+
+private:
+    struct Route {
+        Method method { Method::Get };
+        const char* path { nullptr };
+    };
+
+    http::IRouter& router_;
+
+    std::vector<Route> routes_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <memory>
+#include <new>
+
+#include "ocs_status/macros.h"
+
+#include "bonsai_http/chunked_json_writer.h"
+#include "bonsai_http/http_chunk_writer.h"
+#include "bonsai_http/response_ops.h"
+
+namespace ocs {
+namespace bonsai {
+
+status::StatusCode ResponseOps::send_json(httpd_req_t* req, const cJSON* json) {
+    if (httpd_resp_set_type(req, HTTPD_TYPE_JSON) != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    // Handlers run on the HTTP server task with the limited stack.
+    std::unique_ptr<char[]> chunk(new (std::nothrow)
+                                      char[CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE]);
+    if (!chunk) {
+        return status::StatusCode::NoMem;
+    }
+
+    HttpChunkWriter chunk_writer(req);
+    ChunkedJsonWriter json_writer(chunk_writer, chunk.get(),
+                                  CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE);
+
+    OCS_STATUS_RETURN_ON_ERROR(json_writer.write(json));
+
+    return chunk_writer.finish();
+}
+
+status::StatusCode
+ResponseOps::send_text(httpd_req_t* req, const char* status, const char* message) {
+    auto err = httpd_resp_set_status(req, status);
+    if (err == ESP_OK) {
+        err = httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
+    }
+    if (err == ESP_OK) {
+        err = httpd_resp_sendstr(req, message);
+    }
+
+    return err == ESP_OK ? status::StatusCode::OK : status::StatusCode::Error;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "cJSON.h"
+#include "esp_http_server.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Various operations to build the HTTP responses.
+class ResponseOps : public core::NonCopyable<> {
+public:
+    //! Send @p json as the response body, with HTTP chunked encoding.
+    static status::StatusCode send_json(httpd_req_t* req, const cJSON* json);
+
+    //! Send @p status with the plain text @p message.
+    static status::StatusCode
+    send_text(httpd_req_t* req, const char* status, const char* message);
+};
+
+} // namespace bonsai
+} // namespace ocs
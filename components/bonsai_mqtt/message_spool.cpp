@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_mqtt/message_spool.h"
+
+namespace ocs {
+namespace bonsai {
+
+MessageSpool::MessageSpool(size_t capacity)
+    : capacity_(capacity) {
+    buf_.reset(new (std::nothrow) uint8_t[capacity_]);
+    configASSERT(buf_);
+}
+
+bool MessageSpool::push(uint8_t topic, const char* data, size_t size) {
+    const size_t record_size = header_size_ + size;
+
+    if (size > UINT16_MAX || record_size > capacity_) {
+        return false;
+    }
+
+    if (pinned_ && capacity_ - used_ < record_size) {
+        ++drop_count_;
+        return true;
+    }
+
+    while (capacity_ - used_ < record_size) {
+        pop();
+        ++drop_count_;
+    }
+
+    const uint8_t header[header_size_] = {
+        topic,
+        static_cast<uint8_t>(size & 0xFF),
+        static_cast<uint8_t>(size >> 8),
+    };
+
+    const size_t tail = (head_ + used_) % capacity_;
+
+    write_(tail, header, sizeof(header));
+    write_((tail + header_size_) % capacity_, data, size);
+
+    used_ += record_size;
+    ++count_;
+
+    return true;
+}
+
+size_t MessageSpool::front(uint8_t& topic, char* buf, size_t size) const {
+    if (!count_) {
+        return 0;
+    }
+
+    uint8_t header[header_size_];
+    read_(head_, header, sizeof(header));
+
+    const size_t message_size = header[1] | (header[2] << 8);
+    if (message_size > size) {
+        return 0;
+    }
+
+    read_((head_ + header_size_) % capacity_, buf, message_size);
+    topic = header[0];
+
+    return message_size;
+}
+
+void MessageSpool::pop() {
+    if (!count_) {
+        return;
+    }
+
+    uint8_t header[header_size_];
+    read_(head_, header, sizeof(header));
+
+    const size_t record_size = header_size_ + (header[1] | (header[2] << 8));
+
+    head_ = (head_ + record_size) % capacity_;
+    used_ -= record_size;
+    --count_;
+
+    pinned_ = false;
+}
+
+void MessageSpool::pin_front(bool pinned) {
+    pinned_ = pinned && count_;
+}
+
+unsigned MessageSpool::get_count() const {
+    return count_;
+}
+
+unsigned MessageSpool::get_drop_count() const {
+    return drop_count_;
+}
+
+void MessageSpool::write_(size_t pos, const void* data, size_t size) {
+    const size_t first = std::min(size, capacity_ - pos);
+
+    memcpy(buf_.get() + pos, data, first);
+    memcpy(buf_.get(), static_cast<const uint8_t*>(data) + first, size - first);
+}
+
+void MessageSpool::read_(size_t pos, void* data, size_t size) const {
+    const size_t first = std::min(size, capacity_ - pos);
+
+    memcpy(data, buf_.get() + pos, first);
+    memcpy(static_cast<uint8_t*>(data) + first, buf_.get(), size - first);
+}
+
+} // namespace bonsai
+} // namespace ocs
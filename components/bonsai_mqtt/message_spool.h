@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Bounded FIFO of the messages waiting to be published.
+//!
+//! @remarks
+//!  Messages are stored back to back in the fixed-size ring buffer. When the
+//!  buffer is full, the oldest messages are dropped to make room for the new one,
+//!  unless the oldest message is pinned, then the new message is dropped instead.
+//!  The spool isn't thread-safe.
+class MessageSpool : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p capacity - ring buffer size, in bytes.
+    explicit MessageSpool(size_t capacity);
+
+    //! Append the message.
+    //!
+    //! @params
+    //!  - @p topic - topic index.
+    //!  - @p data - message payload.
+    //!  - @p size - payload size, in bytes.
+    //!
+    //! @return
+    //!  false if the message doesn't fit into the empty spool.
+    //!
+    //! @remarks
+    //!  The message is dropped and counted in get_drop_count() if there is no room
+    //!  for it and the oldest message is pinned.
+    bool push(uint8_t topic, const char* data, size_t size);
+
+    //! Copy the oldest message to @p buf.
+    //!
+    //! @return
+    //!  Payload size, or 0 if the spool is empty or @p size is too small.
+    size_t front(uint8_t& topic, char* buf, size_t size) const;
+
+    //! Remove the oldest message.
+    //!
+    //! @notes
+    //!  Unpins the oldest message.
+    void pop();
+
+    //! Protect the oldest message from being dropped when the spool is full.
+    //!
+    //! @remarks
+    //!  Used while the oldest message is being published and isn't acknowledged yet.
+    void pin_front(bool pinned);
+
+    //! Return the number of messages in the spool.
+    unsigned get_count() const;
+
+    //! Return the number of messages dropped because the spool was full.
+    unsigned get_drop_count() const;
+
+private:
+    static constexpr size_t header_size_ = 3;
+
+    void write_(size_t pos, const void* data, size_t size);
+    void read_(size_t pos, void* data, size_t size) const;
+
+    const size_t capacity_ { 0 };
+    std::unique_ptr<uint8_t[]> buf_;
+
+    size_t head_ { 0 };
+    size_t used_ { 0 };
+
+    unsigned count_ { 0 };
+    unsigned drop_count_ { 0 };
+
+    bool pinned_ { false };
+};
+
+} // namespace bonsai
+} // namespace ocs
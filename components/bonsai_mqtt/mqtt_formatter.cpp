@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_mqtt/mqtt_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+MqttFormatter::MqttFormatter(MqttPublisher& publisher)
+    : publisher_(publisher) {
+}
+
+status::StatusCode MqttFormatter::format(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_bool_cs("mqtt_connected", publisher_.is_connected())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("mqtt_spool_count", publisher_.get_spool_count())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("mqtt_drop_count", publisher_.get_drop_count())) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_mqtt/mqtt_publisher.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the MQTT publisher state.
+class MqttFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit MqttFormatter(MqttPublisher& publisher);
+
+    //! Format the publisher state into @p json.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    MqttPublisher& publisher_;
+};
+
+} // namespace bonsai
+} // namespace ocs
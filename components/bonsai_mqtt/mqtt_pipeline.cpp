@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_mqtt/mqtt_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+MqttPipeline::MqttPipeline(core::IClock& clock,
+                           scheduler::ITaskScheduler& task_scheduler,
+                           fmt::json::FanoutFormatter& telemetry_formatter,
+                           DeadbandPipeline& deadband_pipeline,
+                           EventBusPipeline& event_bus_pipeline,
+                           const char* client_id)
+    : event_bus_pipeline_(event_bus_pipeline) {
+#ifdef CONFIG_BONSAI_FIRMWARE_MQTT_ENABLE
+    publisher_.reset(new (std::nothrow) MqttPublisher(
+        clock, deadband_pipeline.make_filter(),
+        MqttPublisher::Params {
+            .uri = CONFIG_BONSAI_FIRMWARE_MQTT_BROKER_URI,
+            .client_id = client_id,
+            .topic_prefix = CONFIG_BONSAI_FIRMWARE_MQTT_TOPIC_PREFIX,
+            .batch_size = CONFIG_BONSAI_FIRMWARE_MQTT_BATCH_SIZE,
+            .message_size = CONFIG_BONSAI_FIRMWARE_MQTT_MESSAGE_SIZE,
+            .spool_size = CONFIG_BONSAI_FIRMWARE_MQTT_SPOOL_SIZE,
+        }));
+    configASSERT(publisher_);
+
+    configASSERT(task_scheduler.add(*publisher_, "mqtt_publisher",
+                                    core::Duration::second
+                                        * CONFIG_BONSAI_FIRMWARE_MQTT_SAMPLE_INTERVAL)
+                 == status::StatusCode::OK);
+
+    formatter_.reset(new (std::nothrow) MqttFormatter(*publisher_));
+    configASSERT(formatter_);
+
+    telemetry_formatter.add(*formatter_);
+#else
+    (void)clock;
+    (void)task_scheduler;
+    (void)telemetry_formatter;
+    (void)deadband_pipeline;
+    (void)client_id;
+#endif // CONFIG_BONSAI_FIRMWARE_MQTT_ENABLE
+}
+
+void MqttPipeline::add(fmt::json::IFormatter& formatter, const char* id) {
+    if (publisher_) {
+        publisher_->add(formatter, id, nullptr);
+    }
+}
+
+void MqttPipeline::add(fmt::json::IFormatter& formatter,
+                       const char* id,
+                       EventBus::Filter filter) {
+    if (publisher_) {
+        publisher_->add(formatter, id, event_bus_pipeline_.subscribe(id, filter));
+    }
+}
+
+status::StatusCode MqttPipeline::start() {
+    if (publisher_) {
+        return publisher_->start();
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_scheduler/itask_scheduler.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_deadband/deadband_pipeline.h"
+#include "bonsai_event/event_bus_pipeline.h"
+#include "bonsai_mqtt/mqtt_formatter.h"
+#include "bonsai_mqtt/mqtt_publisher.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Publish the sensor telemetry to the MQTT broker.
+//!
+//! @remarks
+//!  If CONFIG_BONSAI_FIRMWARE_MQTT_ENABLE is disabled, nothing is published.
+class MqttPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p telemetry_formatter to add the publisher state to.
+    //!  - @p client_id - MQTT client identifier, usually the mDNS hostname.
+    MqttPipeline(core::IClock& clock,
+                 scheduler::ITaskScheduler& task_scheduler,
+                 fmt::json::FanoutFormatter& telemetry_formatter,
+                 DeadbandPipeline& deadband_pipeline,
+                 EventBusPipeline& event_bus_pipeline,
+                 const char* client_id);
+
+    //! Publish the data formatted by @p formatter to the topic of the sensor @p id.
+    //!
+    //! @remarks
+    //!  The data is sampled each run.
+    void add(fmt::json::IFormatter& formatter, const char* id);
+
+    //! Publish the data formatted by @p formatter to the topic of the sensor @p id.
+    //!
+    //! @remarks
+    //!  The data is sampled only if the sensor readings matching @p filter were
+    //!  published on the event bus since the last run. If the event bus is disabled,
+    //!  the data is sampled each run.
+    //!
+    //! @notes
+    //!  Should be called before the task scheduler is started.
+    void add(fmt::json::IFormatter& formatter, const char* id, EventBus::Filter filter);
+
+    //! Start connecting to the broker.
+    //!
+    //! @remarks
+    //!  Should be called when the network is started.
+    status::StatusCode start();
+
+private:
+    EventBusPipeline& event_bus_pipeline_;
+
+    std::unique_ptr<MqttPublisher> publisher_;
+    std::unique_ptr<MqttFormatter> formatter_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_core/tracer.h"
+#include "bonsai_mqtt/mqtt_publisher.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "mqtt_publisher";
+
+using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+// A message is resent if it isn't acknowledged during this interval.
+const core::Time ack_timeout = core::Duration::second * 60;
+
+} // namespace
+
+MqttPublisher::MqttPublisher(core::IClock& clock, DeadbandFilter* filter, Params params)
+    : params_(params)
+    , clock_(clock)
+    , filter_(filter)
+    , spool_(params.spool_size) {
+    configASSERT(params_.uri);
+    configASSERT(params_.client_id);
+    configASSERT(params_.topic_prefix);
+    configASSERT(params_.batch_size);
+    configASSERT(params_.message_size > 2);
+
+    reading_buf_.reset(new (std::nothrow) char[params_.message_size]);
+    configASSERT(reading_buf_);
+
+    message_buf_.reset(new (std::nothrow) char[params_.message_size]);
+    configASSERT(message_buf_);
+
+    esp_mqtt_client_config_t config;
+    memset(&config, 0, sizeof(config));
+
+    config.broker.address.uri = params_.uri;
+    config.credentials.client_id = params_.client_id;
+
+    client_ = esp_mqtt_client_init(&config);
+    configASSERT(client_);
+
+    configASSERT(
+        esp_mqtt_client_register_event(client_, MQTT_EVENT_ANY, handle_event_, this)
+        == ESP_OK);
+}
+
+MqttPublisher::~MqttPublisher() {
+    esp_mqtt_client_destroy(client_);
+}
+
+void MqttPublisher::add(fmt::json::IFormatter& formatter,
+                        const char* id,
+                        EventBus::Subscriber* subscriber) {
+    configASSERT(topics_.size() < UINT8_MAX);
+
+    std::unique_ptr<Topic> topic(new (std::nothrow) Topic());
+    configASSERT(topic);
+
+    topic->formatter = &formatter;
+    topic->subscriber = subscriber;
+
+    const int ret = snprintf(topic->name, sizeof(topic->name), "%s/%s/%s",
+                             params_.topic_prefix, params_.client_id, id);
+    configASSERT(ret > 0 && static_cast<size_t>(ret) < sizeof(topic->name));
+
+    topic->batch.reset(new (std::nothrow) char[params_.message_size]);
+    configASSERT(topic->batch);
+
+    topics_.push_back(std::move(topic));
+}
+
+status::StatusCode MqttPublisher::start() {
+    const auto err = esp_mqtt_client_start(client_);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_mqtt_client_start(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode MqttPublisher::run() {
+    TraceScope trace_scope("mqtt", "publish");
+
+    for (unsigned n = 0; n < topics_.size(); ++n) {
+        if (!updated_(n)) {
+            continue;
+        }
+
+        const auto code = sample_(n);
+        if (code != status::StatusCode::OK) {
+            bonsai_logw(log_tag, "failed to sample: topic=%s code=%s", topics_[n]->name,
+                        status::code_to_str(code));
+        }
+    }
+
+    {
+        MutexLock lock(mu_);
+
+        if (inflight_id_ >= 0 && clock_.now() - inflight_ts_ > ack_timeout) {
+            bonsai_logw(log_tag, "message isn't acknowledged, resend: msg_id=%d",
+                        inflight_id_);
+
+            inflight_id_ = -1;
+            spool_.pin_front(false);
+        }
+    }
+
+    send_();
+
+    return status::StatusCode::OK;
+}
+
+bool MqttPublisher::is_connected() const {
+    MutexLock lock(mu_);
+    return connected_;
+}
+
+unsigned MqttPublisher::get_spool_count() const {
+    MutexLock lock(mu_);
+    return spool_.get_count();
+}
+
+unsigned MqttPublisher::get_drop_count() const {
+    MutexLock lock(mu_);
+    return spool_.get_drop_count();
+}
+
+void MqttPublisher::handle_event_(void* arg,
+                                  esp_event_base_t base,
+                                  int32_t id,
+                                  void* event_data) {
+    (void)base;
+
+    MqttPublisher& self = *static_cast<MqttPublisher*>(arg);
+
+    switch (id) {
+    case MQTT_EVENT_CONNECTED:
+        self.handle_connected_();
+        break;
+
+    case MQTT_EVENT_DISCONNECTED:
+        self.handle_disconnected_();
+        break;
+
+    case MQTT_EVENT_PUBLISHED:
+        self.handle_published_(static_cast<esp_mqtt_event_handle_t>(event_data)->msg_id);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void MqttPublisher::handle_connected_() {
+    {
+        MutexLock lock(mu_);
+
+        ocs_logi(log_tag, "connected: spooled=%u", spool_.get_count());
+
+        connected_ = true;
+    }
+
+    send_();
+}
+
+void MqttPublisher::handle_disconnected_() {
+    MutexLock lock(mu_);
+
+    bonsai_logw(log_tag, "disconnected: spooled=%u", spool_.get_count());
+
+    // The in-flight message stays in the client outbox and is retransmitted after
+    // reconnect, it's resent by the spool only if it isn't acknowledged in time.
+    connected_ = false;
+}
+
+void MqttPublisher::handle_published_(int msg_id) {
+    {
+        MutexLock lock(mu_);
+
+        if (msg_id != inflight_id_) {
+            // The message can be acknowledged before send_() records its id.
+            if (sending_) {
+                acked_id_ = msg_id;
+            }
+
+            return;
+        }
+
+        spool_.pop();
+        inflight_id_ = -1;
+    }
+
+    send_();
+}
+
+bool MqttPublisher::updated_(uint8_t index) {
+    Topic& topic = *topics_[index];
+
+    if (!topic.subscriber) {
+        return true;
+    }
+
+    // Only the fact of the reading matters, the data is formatted from the sensor.
+    bool updated = false;
+
+    SensorEvent event;
+    while (topic.subscriber->pop(event)) {
+        updated = true;
+    }
+
+    return updated;
+}
+
+status::StatusCode MqttPublisher::sample_(uint8_t index) {
+    Topic& topic = *topics_[index];
+
+    JsonPtr json(cJSON_CreateObject(), cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = topic.formatter->format(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    if (filter_ && !filter_->apply(json.get())) {
+        return status::StatusCode::OK;
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(json.get());
+
+    if (!formatter.add_number_cs("ts", time(nullptr))) {
+        return status::StatusCode::NoMem;
+    }
+
+    // Reserve space for the array brackets.
+    if (!cJSON_PrintPreallocated(json.get(), reading_buf_.get(), params_.message_size - 2,
+                                 false)) {
+        return status::StatusCode::NoMem;
+    }
+
+    const size_t reading_size = strlen(reading_buf_.get());
+
+    if (topic.count && topic.size + reading_size + 2 > params_.message_size) {
+        flush_(index);
+    }
+
+    topic.batch[topic.size] = topic.count ? ',' : '[';
+    ++topic.size;
+
+    memcpy(topic.batch.get() + topic.size, reading_buf_.get(), reading_size);
+    topic.size += reading_size;
+
+    ++topic.count;
+
+    if (topic.count == params_.batch_size) {
+        flush_(index);
+    }
+
+    return status::StatusCode::OK;
+}
+
+void MqttPublisher::flush_(uint8_t index) {
+    Topic& topic = *topics_[index];
+
+    topic.batch[topic.size] = ']';
+    ++topic.size;
+
+    MutexLock lock(mu_);
+
+    if (!spool_.push(index, topic.batch.get(), topic.size)) {
+        ocs_loge(log_tag, "message doesn't fit into spool: topic=%s size=%u", topic.name,
+                 static_cast<unsigned>(topic.size));
+    }
+
+    topic.size = 0;
+    topic.count = 0;
+}
+
+void MqttPublisher::send_() {
+    for (;;) {
+        uint8_t index = 0;
+        size_t size = 0;
+
+        {
+            MutexLock lock(mu_);
+
+            if (!connected_ || inflight_id_ >= 0 || sending_) {
+                return;
+            }
+
+            size = spool_.front(index, message_buf_.get(), params_.message_size);
+            if (!size) {
+                return;
+            }
+
+            // The message should stay in the spool until it's acknowledged, it's
+            // resent from the spool if it isn't acknowledged in time.
+            spool_.pin_front(true);
+
+            sending_ = true;
+            acked_id_ = -1;
+        }
+
+        // mu_ isn't held here: the client takes its API lock, which is also held by
+        // the MQTT task while it dispatches the events, and the event handlers take
+        // mu_. message_buf_ is used only by the task which set sending_.
+        const int msg_id = esp_mqtt_client_enqueue(client_, topics_[index]->name,
+                                                   message_buf_.get(), size, 1, 0, true);
+
+        MutexLock lock(mu_);
+
+        sending_ = false;
+
+        if (msg_id < 0) {
+            bonsai_logw(log_tag, "failed to enqueue message: topic=%s",
+                        topics_[index]->name);
+
+            spool_.pin_front(false);
+            return;
+        }
+
+        if (msg_id != acked_id_) {
+            inflight_id_ = msg_id;
+            inflight_ts_ = clock_.now();
+            return;
+        }
+
+        spool_.pop();
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mqtt_client.h"
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_deadband/deadband_filter.h"
+#include "bonsai_event/event_bus.h"
+#include "bonsai_mqtt/message_spool.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Publish the sensor readings to the MQTT broker.
+//!
+//! @remarks
+//!  - Each sensor is published to its own topic: "<prefix>/<client_id>/<sensor_id>".
+//!  - Each run, a reading of each sensor is passed through the deadband filter, if
+//!    any, and appended to the sensor batch, unless nothing has changed. When the
+//!    batch is full, it's moved to the spool as a single message, a JSON array of
+//!    the readings, each reading has the "ts" field with the UNIX time.
+//!  - A sensor subscribed to the event bus is sampled only if it was read since the
+//!    last run, so a slowly sampled sensor doesn't produce duplicate readings.
+//!  - Messages are published from the spool in order, with QoS 1, one message at a
+//!    time. The message is removed from the spool only when the broker acknowledges
+//!    it, so the messages spooled while the broker is unreachable are replayed after
+//!    reconnect. The delivery is at-least-once, a message may be duplicated if the
+//!    acknowledgement is lost.
+//!  - The message being published is never dropped from the full spool until it's
+//!    acknowledged or the acknowledgement times out, the new messages are dropped
+//!    instead.
+//!  - The spool is kept in RAM only, the spooled messages are lost on reboot.
+class MqttPublisher : public scheduler::ITask, public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Broker URI, e.g. "mqtt://192.168.1.10:1883".
+        const char* uri { nullptr };
+
+        //! MQTT client identifier, also used as a topic level.
+        const char* client_id { nullptr };
+
+        //! First level of the topic.
+        const char* topic_prefix { nullptr };
+
+        //! Number of readings in a single message.
+        unsigned batch_size { 0 };
+
+        //! Maximum message size, in bytes.
+        size_t message_size { 0 };
+
+        //! Spool size, in bytes.
+        size_t spool_size { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p filter to drop the insignificant changes, nullptr to report all fields.
+    MqttPublisher(core::IClock& clock, DeadbandFilter* filter, Params params);
+
+    //! Destroy the MQTT client.
+    ~MqttPublisher();
+
+    //! Publish the data formatted by @p formatter to the topic of the sensor @p id.
+    //!
+    //! @params
+    //!  - @p subscriber to receive the sensor readings, nullptr to sample the sensor
+    //!    each run.
+    void add(fmt::json::IFormatter& formatter,
+             const char* id,
+             EventBus::Subscriber* subscriber);
+
+    //! Start connecting to the broker.
+    status::StatusCode start();
+
+    //! Read the sensors and publish the spooled messages.
+    status::StatusCode run() override;
+
+    //! Return true if the client is connected to the broker.
+    bool is_connected() const;
+
+    //! Return the number of messages waiting to be published.
+    unsigned get_spool_count() const;
+
+    //! Return the number of messages dropped because the spool was full.
+    unsigned get_drop_count() const;
+
+private:
+    struct Topic {
+        fmt::json::IFormatter* formatter { nullptr };
+        EventBus::Subscriber* subscriber { nullptr };
+        char name[64];
+
+        std::unique_ptr<char[]> batch;
+        size_t size { 0 };
+        unsigned count { 0 };
+    };
+
+    static void
+    handle_event_(void* arg, esp_event_base_t base, int32_t id, void* event_data);
+
+    void handle_connected_();
+    void handle_disconnected_();
+    void handle_published_(int msg_id);
+
+    bool updated_(uint8_t index);
+    status::StatusCode sample_(uint8_t index);
+    void flush_(uint8_t index);
+    void send_();
+
+    const Params params_;
+
+    core::IClock& clock_;
+    DeadbandFilter* filter_ { nullptr };
+
+    esp_mqtt_client_handle_t client_ { nullptr };
+
+    std::vector<std::unique_ptr<Topic>> topics_;
+    std::unique_ptr<char[]> reading_buf_;
+
+    mutable StaticMutex mu_;
+
+    MessageSpool spool_;
+    std::unique_ptr<char[]> message_buf_;
+
+    bool connected_ { false };
+    bool sending_ { false };
+    int acked_id_ { -1 };
+    int inflight_id_ { -1 };
+    core::Time inflight_ts_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
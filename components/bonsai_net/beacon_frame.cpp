@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_net/beacon_frame.h"
+
+namespace ocs {
+namespace bonsai {
+
+size_t BeaconFrame::get_max_size(unsigned field_count) {
+    return header_size_ + (field_count + 7) / 8 + field_count * sizeof(float)
+        + crc_size_;
+}
+
+BeaconFrame::BeaconFrame(uint8_t* buf, size_t size)
+    : buf_(buf)
+    , size_(size) {
+    configASSERT(buf_);
+}
+
+void BeaconFrame::begin(const uint8_t* device_id,
+                        uint32_t seq,
+                        uint32_t timestamp,
+                        uint32_t schema,
+                        unsigned field_count) {
+    configASSERT(field_count <= UINT8_MAX);
+    configASSERT(get_max_size(field_count) <= size_);
+
+    pos_ = 0;
+    field_count_ = field_count;
+    last_index_ = -1;
+
+    buf_[pos_++] = 'B';
+    buf_[pos_++] = 'B';
+    buf_[pos_++] = version;
+    buf_[pos_++] = field_count;
+
+    memcpy(buf_ + pos_, device_id, device_id_size);
+    pos_ += device_id_size;
+
+    write_u32_(seq);
+    write_u32_(timestamp);
+    write_u32_(schema);
+
+    const size_t bitmap_size = (field_count + 7) / 8;
+
+    memset(buf_ + pos_, 0, bitmap_size);
+    pos_ += bitmap_size;
+}
+
+void BeaconFrame::add(unsigned index, float value) {
+    configASSERT(index < field_count_);
+    configASSERT(static_cast<int>(index) > last_index_);
+
+    last_index_ = index;
+
+    buf_[header_size_ + index / 8] |= 1 << (index % 8);
+
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+
+    write_u32_(bits);
+}
+
+size_t BeaconFrame::end() {
+    write_u32_(esp_rom_crc32_le(0, buf_, pos_));
+
+    return pos_;
+}
+
+void BeaconFrame::write_u32_(uint32_t value) {
+    buf_[pos_++] = value & 0xFF;
+    buf_[pos_++] = (value >> 8) & 0xFF;
+    buf_[pos_++] = (value >> 16) & 0xFF;
+    buf_[pos_++] = (value >> 24) & 0xFF;
+}
+
+} // namespace bonsai
+} // namespace ocs
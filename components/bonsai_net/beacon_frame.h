@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Binary telemetry frame.
+//!
+//! @remarks
+//!  All fields are little-endian:
+//!   - magic, 2 bytes, "BB".
+//!   - version, 1 byte.
+//!   - number of fields in the schema, 1 byte.
+//!   - device identifier, 6 bytes, WiFi STA MAC address.
+//!   - sequence number, 4 bytes.
+//!   - UNIX time, 4 bytes.
+//!   - schema identifier, 4 bytes, CRC-32 of the field names.
+//!   - field bitmap, 1 bit per schema field, rounded up to bytes. The bit is set
+//!     if the field value is present in the frame.
+//!   - values of the present fields, float32 each, in the schema order.
+//!   - CRC-32 of all the preceding bytes, 4 bytes.
+class BeaconFrame : public core::NonCopyable<> {
+public:
+    //! Frame format version.
+    static constexpr uint8_t version = 1;
+
+    //! Device identifier size, in bytes.
+    static constexpr size_t device_id_size = 6;
+
+    //! Return the maximum frame size for the schema with @p field_count fields.
+    static size_t get_max_size(unsigned field_count);
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p buf to write the frame to.
+    //!  - @p size - @p buf size, in bytes.
+    BeaconFrame(uint8_t* buf, size_t size);
+
+    //! Write the frame header.
+    void begin(const uint8_t* device_id,
+               uint32_t seq,
+               uint32_t timestamp,
+               uint32_t schema,
+               unsigned field_count);
+
+    //! Write the value of the field at @p index.
+    //!
+    //! @remarks
+    //!  Fields should be written in the increasing @p index order.
+    void add(unsigned index, float value);
+
+    //! Write the frame checksum.
+    //!
+    //! @return
+    //!  Frame size, in bytes.
+    size_t end();
+
+private:
+    static constexpr size_t header_size_ = 22;
+    static constexpr size_t crc_size_ = 4;
+
+    void write_u32_(uint32_t value);
+
+    uint8_t* const buf_ { nullptr };
+    const size_t size_ { 0 };
+
+    size_t pos_ { 0 };
+    unsigned field_count_ { 0 };
+    int last_index_ { -1 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_net/beacon_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+BeaconPipeline::BeaconPipeline(scheduler::ITaskScheduler& task_scheduler,
+                               http::IRouter& router,
+                               fmt::json::IFormatter& telemetry_formatter,
+                               DeadbandPipeline& deadband_pipeline) {
+#ifdef CONFIG_BONSAI_FIRMWARE_BEACON_ENABLE
+    beacon_.reset(new (std::nothrow) UdpBeacon(
+        telemetry_formatter, deadband_pipeline.make_filter(),
+        UdpBeacon::Params {
+            .address = CONFIG_BONSAI_FIRMWARE_BEACON_ADDRESS,
+            .port = CONFIG_BONSAI_FIRMWARE_BEACON_PORT,
+            .ttl = CONFIG_BONSAI_FIRMWARE_BEACON_TTL,
+            .max_field_count = CONFIG_BONSAI_FIRMWARE_BEACON_MAX_FIELD_COUNT,
+        }));
+    configASSERT(beacon_);
+
+    configASSERT(task_scheduler.add(*beacon_, "udp_beacon",
+                                    core::Duration::second
+                                        * CONFIG_BONSAI_FIRMWARE_BEACON_INTERVAL)
+                 == status::StatusCode::OK);
+
+    schema_handler_.reset(new (std::nothrow) JsonStreamHandler(
+        *beacon_, CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(schema_handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/beacon/schema",
+               [this](httpd_req_t* req) {
+                   return schema_handler_->handle(req);
+               });
+#else
+    (void)task_scheduler;
+    (void)router;
+    (void)telemetry_formatter;
+    (void)deadband_pipeline;
+#endif // CONFIG_BONSAI_FIRMWARE_BEACON_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
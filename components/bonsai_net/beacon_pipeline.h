@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_http/irouter.h"
+#include "ocs_scheduler/itask_scheduler.h"
+
+#include "bonsai_deadband/deadband_pipeline.h"
+#include "bonsai_http/json_stream_handler.h"
+#include "bonsai_net/udp_beacon.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Periodically send the telemetry in the UDP beacon.
+//!
+//! @remarks
+//!  The frame schema is available via GET /api/v1/beacon/schema. If
+//!  CONFIG_BONSAI_FIRMWARE_BEACON_ENABLE is disabled, nothing is sent.
+class BeaconPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    BeaconPipeline(scheduler::ITaskScheduler& task_scheduler,
+                   http::IRouter& router,
+                   fmt::json::IFormatter& telemetry_formatter,
+                   DeadbandPipeline& deadband_pipeline);
+
+private:
+    std::unique_ptr<UdpBeacon> beacon_;
+    std::unique_ptr<JsonStreamHandler> schema_handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
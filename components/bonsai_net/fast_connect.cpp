@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_net/fast_connect.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "fast_connect";
+
+} // namespace
+
+FastConnect::FastConnect(storage::IStorage& storage)
+    : storage_(storage) {
+    const auto code = storage_.read(storage_key_, &stored_, sizeof(stored_));
+    if (code == status::StatusCode::OK) {
+        has_stored_ = stored_.ssid_len <= sizeof(stored_.ssid) && stored_.channel;
+    } else if (code != status::StatusCode::NoData) {
+        ocs_logw(log_tag, "failed to read access point: %s", status::code_to_str(code));
+    }
+
+    auto err = esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
+                                                   handle_event_, this,
+                                                   &wifi_event_instance_);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "failed to register WiFi event handler: %s",
+                 esp_err_to_name(err));
+    }
+
+    err = esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                              handle_event_, this, &ip_event_instance_);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "failed to register IP event handler: %s",
+                 esp_err_to_name(err));
+    }
+}
+
+FastConnect::~FastConnect() {
+    if (wifi_event_instance_) {
+        esp_event_handler_instance_unregister(WIFI_EVENT, ESP_EVENT_ANY_ID,
+                                              wifi_event_instance_);
+    }
+
+    if (ip_event_instance_) {
+        esp_event_handler_instance_unregister(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                              ip_event_instance_);
+    }
+}
+
+status::StatusCode FastConnect::prepare() {
+    if (!has_stored_) {
+        return status::StatusCode::OK;
+    }
+
+    wifi_config_t config;
+    memset(&config, 0, sizeof(config));
+
+    auto err = esp_wifi_get_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_get_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    const size_t ssid_len = strnlen(reinterpret_cast<const char*>(config.sta.ssid),
+                                    sizeof(config.sta.ssid));
+
+    if (ssid_len != stored_.ssid_len || memcmp(config.sta.ssid, stored_.ssid, ssid_len)) {
+        ocs_logi(log_tag, "SSID has changed, scan all channels");
+        return status::StatusCode::OK;
+    }
+
+    config.sta.bssid_set = true;
+    memcpy(config.sta.bssid, stored_.bssid, sizeof(config.sta.bssid));
+    config.sta.channel = stored_.channel;
+
+    err = esp_wifi_set_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_set_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    locked_ = true;
+    used_ = true;
+
+    ocs_logi(log_tag, "connect to the stored access point: channel=%u", stored_.channel);
+
+    return status::StatusCode::OK;
+}
+
+bool FastConnect::is_used() const {
+    return used_;
+}
+
+int64_t FastConnect::get_connect_time() const {
+    return connect_time_;
+}
+
+int64_t FastConnect::get_assoc_to_ip_time() const {
+    return assoc_to_ip_time_;
+}
+
+void FastConnect::handle_event_(void* arg,
+                                esp_event_base_t event_base,
+                                int32_t event_id,
+                                void* event_data) {
+    FastConnect& self = *static_cast<FastConnect*>(arg);
+
+    if (event_base == IP_EVENT) {
+        self.handle_got_ip_();
+        return;
+    }
+
+    switch (event_id) {
+    case WIFI_EVENT_STA_START:
+        self.handle_sta_start_();
+        break;
+
+    case WIFI_EVENT_STA_CONNECTED:
+        self.handle_sta_connected_(event_data);
+        break;
+
+    case WIFI_EVENT_STA_DISCONNECTED:
+        self.handle_sta_disconnected_();
+        break;
+
+    default:
+        break;
+    }
+}
+
+void FastConnect::handle_sta_start_() {
+    start_timestamp_ = esp_timer_get_time();
+}
+
+void FastConnect::handle_sta_connected_(void* event_data) {
+    assoc_timestamp_ = esp_timer_get_time();
+
+    const wifi_event_sta_connected_t& event =
+        *static_cast<const wifi_event_sta_connected_t*>(event_data);
+
+    connected_ = AccessPoint {};
+    connected_.ssid_len = std::min<uint8_t>(event.ssid_len, sizeof(connected_.ssid));
+    memcpy(connected_.ssid, event.ssid, connected_.ssid_len);
+    memcpy(connected_.bssid, event.bssid, sizeof(connected_.bssid));
+    connected_.channel = event.channel;
+}
+
+void FastConnect::handle_sta_disconnected_() {
+    if (!locked_) {
+        return;
+    }
+
+    // Reconnect to any access point with the configured SSID, in case the stored one
+    // isn't available anymore.
+    locked_ = false;
+
+    auto code = reset_config_();
+    if (code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "failed to reset STA config: %s", status::code_to_str(code));
+    }
+
+    if (connect_time_ >= 0) {
+        return;
+    }
+
+    ocs_logw(log_tag, "failed to connect to the stored access point, scan all channels");
+
+    used_ = false;
+    has_stored_ = false;
+
+    code = storage_.erase(storage_key_);
+    if (code != status::StatusCode::OK && code != status::StatusCode::NoData) {
+        ocs_loge(log_tag, "failed to erase access point: %s", status::code_to_str(code));
+    }
+}
+
+void FastConnect::handle_got_ip_() {
+    const int64_t now = esp_timer_get_time();
+
+    if (connect_time_ < 0) {
+        connect_time_ = now - start_timestamp_;
+    }
+
+    assoc_to_ip_time_ = now - assoc_timestamp_;
+
+    if (has_stored_ && memcmp(&stored_, &connected_, sizeof(stored_)) == 0) {
+        return;
+    }
+
+    const auto code = storage_.write(storage_key_, &connected_, sizeof(connected_));
+    if (code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "failed to store access point: %s", status::code_to_str(code));
+        return;
+    }
+
+    stored_ = connected_;
+    has_stored_ = true;
+}
+
+status::StatusCode FastConnect::reset_config_() {
+    wifi_config_t config;
+    memset(&config, 0, sizeof(config));
+
+    auto err = esp_wifi_get_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_get_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    config.sta.bssid_set = false;
+    memset(config.sta.bssid, 0, sizeof(config.sta.bssid));
+    config.sta.channel = 0;
+
+    err = esp_wifi_set_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_set_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
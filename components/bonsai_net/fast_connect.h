@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "esp_event.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+#include "ocs_storage/istorage.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Connect to the last known access point without the full channel scan.
+//!
+//! @remarks
+//!  BSSID and channel of the access point are stored after each connection which
+//!  ended up with the IP address. Before the network is started, they are applied
+//!  to the STA configuration, if the SSID is still the same. After the first
+//!  disconnect, the STA configuration is restored, so the reconnect scans all channels.
+//!  If the first connection to the stored access point fails, the stored data is
+//!  dropped.
+class FastConnect : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p storage to persist the access point data.
+    explicit FastConnect(storage::IStorage& storage);
+
+    //! Unregister the event handlers.
+    ~FastConnect();
+
+    //! Apply the stored access point data to the STA configuration.
+    //!
+    //! @notes
+    //!  Should be called after the STA network is configured and before it's started.
+    status::StatusCode prepare();
+
+    //! Return true if the current connection used the stored access point data.
+    bool is_used() const;
+
+    //! Return the time from the STA start to the first IP address, in microseconds.
+    //!
+    //! @remarks
+    //!  -1 is returned if the IP address isn't received yet.
+    int64_t get_connect_time() const;
+
+    //! Return the time from the last association to the IP address, in microseconds.
+    //!
+    //! @remarks
+    //!  -1 is returned if the IP address isn't received yet.
+    int64_t get_assoc_to_ip_time() const;
+
+private:
+    struct AccessPoint {
+        uint8_t ssid[32];
+        uint8_t ssid_len;
+        uint8_t bssid[6];
+        uint8_t channel;
+    };
+
+    static constexpr const char* storage_key_ = "ap";
+
+    static void handle_event_(void* arg,
+                              esp_event_base_t event_base,
+                              int32_t event_id,
+                              void* event_data);
+
+    void handle_sta_start_();
+    void handle_sta_connected_(void* event_data);
+    void handle_sta_disconnected_();
+    void handle_got_ip_();
+
+    status::StatusCode reset_config_();
+
+    storage::IStorage& storage_;
+
+    esp_event_handler_instance_t wifi_event_instance_ { nullptr };
+    esp_event_handler_instance_t ip_event_instance_ { nullptr };
+
+    AccessPoint stored_ {};
+    AccessPoint connected_ {};
+    bool has_stored_ { false };
+    bool locked_ { false };
+
+    std::atomic<bool> used_ { false };
+
+    int64_t start_timestamp_ { 0 };
+    int64_t assoc_timestamp_ { 0 };
+    std::atomic<int64_t> connect_time_ { -1 };
+    std::atomic<int64_t> assoc_to_ip_time_ { -1 };
+};
+
+} // namespace bonsai
+} // namespace ocs
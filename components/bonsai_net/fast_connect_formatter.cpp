@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_core/time.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_net/fast_connect_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+int64_t to_ms(int64_t time) {
+    return time < 0 ? time : time / 1000;
+}
+
+} // namespace
+
+FastConnectFormatter::FastConnectFormatter(FastConnect& fast_connect)
+    : fast_connect_(fast_connect) {
+}
+
+status::StatusCode FastConnectFormatter::format(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_bool_cs("wifi_fast_connect", fast_connect_.is_used())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("wifi_connect_time",
+                                 to_ms(fast_connect_.get_connect_time()))) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("wifi_assoc_to_ip_time",
+                                 to_ms(fast_connect_.get_assoc_to_ip_time()))) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
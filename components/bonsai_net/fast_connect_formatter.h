@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_net/fast_connect.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the WiFi connection timings.
+class FastConnectFormatter : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit FastConnectFormatter(FastConnect& fast_connect);
+
+    //! Format whether the stored access point was used, and the connection timings,
+    //! in milliseconds, into @p json.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    FastConnect& fast_connect_;
+};
+
+} // namespace bonsai
+} // namespace ocs
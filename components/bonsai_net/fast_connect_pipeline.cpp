@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_net/fast_connect_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+FastConnectPipeline::FastConnectPipeline(
+    WriteBehindPipeline& write_behind_pipeline,
+    fmt::json::FanoutFormatter& registration_formatter) {
+#ifdef CONFIG_BONSAI_FIRMWARE_WIFI_FAST_CONNECT_ENABLE
+    fast_connect_.reset(
+        new (std::nothrow) FastConnect(write_behind_pipeline.make("fast_connect")));
+    configASSERT(fast_connect_);
+
+    formatter_.reset(new (std::nothrow) FastConnectFormatter(*fast_connect_));
+    configASSERT(formatter_);
+
+    registration_formatter.add(*formatter_);
+#else
+    (void)write_behind_pipeline;
+    (void)registration_formatter;
+#endif // CONFIG_BONSAI_FIRMWARE_WIFI_FAST_CONNECT_ENABLE
+}
+
+status::StatusCode FastConnectPipeline::prepare() {
+    if (!fast_connect_) {
+        return status::StatusCode::OK;
+    }
+
+    return fast_connect_->prepare();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_net/fast_connect.h"
+#include "bonsai_net/fast_connect_formatter.h"
+#include "bonsai_storage/write_behind_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Fast reconnect to the last known access point.
+//!
+//! @remarks
+//!  - Access point data is persisted in the "fast_connect" storage.
+//!  - WiFi connection timings are added to the registration data.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_WIFI_FAST_CONNECT_ENABLE is disabled, the pipeline
+//!  does nothing.
+class FastConnectPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @notes
+    //!  Should be created after the network pipeline.
+    FastConnectPipeline(WriteBehindPipeline& write_behind_pipeline,
+                        fmt::json::FanoutFormatter& registration_formatter);
+
+    //! Apply the stored access point data before the network is started.
+    status::StatusCode prepare();
+
+private:
+    std::unique_ptr<FastConnect> fast_connect_;
+    std::unique_ptr<FastConnectFormatter> formatter_;
+};
+
+} // namespace bonsai
+} // namespace ocs
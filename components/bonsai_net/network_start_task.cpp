@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/boot_profiler.h"
+
+#include "bonsai_net/network_start_task.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "network_start_task";
+
+} // namespace
+
+NetworkStartTask::NetworkStartTask(
+    pipeline::basic::SelectNetworkPipeline& network_pipeline,
+    FastConnectPipeline& fast_connect_pipeline,
+    PowerPipeline& power_pipeline,
+    net::BasicMdnsServer& mdns_server,
+    MqttPipeline& mqtt_pipeline)
+    : network_pipeline_(network_pipeline)
+    , fast_connect_pipeline_(fast_connect_pipeline)
+    , power_pipeline_(power_pipeline)
+    , mdns_server_(mdns_server)
+    , mqtt_pipeline_(mqtt_pipeline) {
+}
+
+status::StatusCode NetworkStartTask::run() {
+    BootProfiler::mark("network_start");
+
+    auto code = fast_connect_pipeline_.prepare();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to prepare fast connect: %s",
+                 status::code_to_str(code));
+    }
+
+    code = power_pipeline_.prepare();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to prepare power save: %s", status::code_to_str(code));
+    }
+
+    code = network_pipeline_.get_runner().start();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to start network: %s", status::code_to_str(code));
+
+        return status::StatusCode::OK;
+    }
+
+    BootProfiler::mark("network_ready");
+
+    code = power_pipeline_.start();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to start power save: %s", status::code_to_str(code));
+    }
+
+    code = start_mdns_();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to start mDNS server: %s", status::code_to_str(code));
+    }
+
+    code = mqtt_pipeline_.start();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to start MQTT pipeline: %s",
+                 status::code_to_str(code));
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode NetworkStartTask::handle_suspend() {
+    MutexLock lock(mu_);
+
+    suspended_ = true;
+
+    if (!network_ready_) {
+        return status::StatusCode::OK;
+    }
+
+    return mdns_server_.stop();
+}
+
+status::StatusCode NetworkStartTask::handle_resume() {
+    MutexLock lock(mu_);
+
+    suspended_ = false;
+
+    if (!network_ready_) {
+        return status::StatusCode::OK;
+    }
+
+    return mdns_server_.start();
+}
+
+status::StatusCode NetworkStartTask::start_mdns_() {
+    MutexLock lock(mu_);
+
+    network_ready_ = true;
+
+    // Started by the suspender on resume.
+    if (suspended_) {
+        return status::StatusCode::OK;
+    }
+
+    return mdns_server_.start();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_net/basic_mdns_server.h"
+#include "ocs_pipeline/basic/select_network_pipeline.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_system/isuspend_handler.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_mqtt/mqtt_pipeline.h"
+#include "bonsai_net/fast_connect_pipeline.h"
+#include "bonsai_power/power_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Start the network and the services which depend on it.
+//!
+//! @remarks
+//!  Can be run either synchronously or from the dedicated FreeRTOS task, while the
+//!  task scheduler is already running. The mDNS server is started once the network
+//!  is ready, and is stopped and restarted by the suspend handler only after that,
+//!  so the network task and the suspender never race on it.
+class NetworkStartTask : public scheduler::ITask,
+                         public system::ISuspendHandler,
+                         public core::NonCopyable<> {
+public:
+    //! Initialize.
+    NetworkStartTask(pipeline::basic::SelectNetworkPipeline& network_pipeline,
+                     FastConnectPipeline& fast_connect_pipeline,
+                     PowerPipeline& power_pipeline,
+                     net::BasicMdnsServer& mdns_server,
+                     MqttPipeline& mqtt_pipeline);
+
+    //! Start the network, then the mDNS server and MQTT.
+    status::StatusCode run() override;
+
+    //! Stop the mDNS server if it's started.
+    status::StatusCode handle_suspend() override;
+
+    //! Start the mDNS server if it was started before the suspend.
+    status::StatusCode handle_resume() override;
+
+private:
+    status::StatusCode start_mdns_();
+
+    pipeline::basic::SelectNetworkPipeline& network_pipeline_;
+    FastConnectPipeline& fast_connect_pipeline_;
+    PowerPipeline& power_pipeline_;
+    net::BasicMdnsServer& mdns_server_;
+    MqttPipeline& mqtt_pipeline_;
+
+    StaticMutex mu_;
+    bool network_ready_ { false };
+    bool suspended_ { false };
+};
+
+} // namespace bonsai
+} // namespace ocs
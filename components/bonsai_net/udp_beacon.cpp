@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include "esp_mac.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_core/tracer.h"
+#include "bonsai_net/udp_beacon.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "udp_beacon";
+
+using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+} // namespace
+
+UdpBeacon::UdpBeacon(fmt::json::IFormatter& formatter,
+                     DeadbandFilter* filter,
+                     Params params)
+    : params_(params)
+    , formatter_(formatter)
+    , filter_(filter)
+    , frame_size_(BeaconFrame::get_max_size(params.max_field_count)) {
+    configASSERT(params_.address);
+    configASSERT(params_.port);
+    configASSERT(params_.max_field_count && params_.max_field_count <= UINT8_MAX);
+
+    memset(&addr_, 0, sizeof(addr_));
+    addr_.sin_family = AF_INET;
+    addr_.sin_port = htons(params_.port);
+    configASSERT(inet_pton(AF_INET, params_.address, &addr_.sin_addr) == 1);
+
+    configASSERT(esp_read_mac(device_id_, ESP_MAC_WIFI_STA) == ESP_OK);
+
+    fields_.reset(new (std::nothrow) Field[params_.max_field_count]);
+    configASSERT(fields_);
+
+    values_.reset(new (std::nothrow) float[params_.max_field_count]);
+    configASSERT(values_);
+
+    present_.reset(new (std::nothrow) bool[params_.max_field_count]);
+    configASSERT(present_);
+
+    frame_buf_.reset(new (std::nothrow) uint8_t[frame_size_]);
+    configASSERT(frame_buf_);
+}
+
+UdpBeacon::~UdpBeacon() {
+    close_();
+}
+
+status::StatusCode UdpBeacon::run() {
+    TraceScope trace_scope("net", "beacon");
+
+    JsonPtr json(cJSON_CreateObject(), cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = formatter_.format(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    if (filter_ && !filter_->apply(json.get())) {
+        return status::StatusCode::OK;
+    }
+
+    MutexLock lock(mu_);
+
+    const unsigned prev_field_count = field_count_;
+
+    memset(present_.get(), 0, params_.max_field_count * sizeof(bool));
+
+    const cJSON* item = nullptr;
+
+    cJSON_ArrayForEach(item, json.get()) {
+        if (!cJSON_IsNumber(item) && !cJSON_IsBool(item)) {
+            continue;
+        }
+
+        const int index = find_field_(item->string);
+        if (index < 0) {
+            continue;
+        }
+
+        values_[index] = cJSON_IsBool(item) ? cJSON_IsTrue(item) : item->valuedouble;
+        present_[index] = true;
+    }
+
+    if (field_count_ != prev_field_count) {
+        update_schema_();
+    }
+
+    BeaconFrame frame(frame_buf_.get(), frame_size_);
+    frame.begin(device_id_, seq_, time(nullptr), schema_, field_count_);
+
+    for (unsigned n = 0; n < field_count_; ++n) {
+        if (present_[n]) {
+            frame.add(n, values_[n]);
+        }
+    }
+
+    const size_t size = frame.end();
+
+    ++seq_;
+
+    return send_(size);
+}
+
+status::StatusCode UdpBeacon::format(cJSON* json) {
+    MutexLock lock(mu_);
+
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_number_cs("schema", schema_)) {
+        return status::StatusCode::NoMem;
+    }
+
+    cJSON* array = cJSON_AddArrayToObject(json, "fields");
+    if (!array) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (unsigned n = 0; n < field_count_; ++n) {
+        cJSON* item = cJSON_CreateStringReference(fields_[n].key);
+        if (!item) {
+            return status::StatusCode::NoMem;
+        }
+
+        cJSON_AddItemToArray(array, item);
+    }
+
+    return status::StatusCode::OK;
+}
+
+int UdpBeacon::find_field_(const char* key) {
+    // Telemetry fields are usually formatted in the same order, start from the
+    // field following the previous match.
+    for (unsigned n = 0; n < field_count_; ++n) {
+        const unsigned index = (field_hint_ + n) % field_count_;
+
+        if (strcmp(fields_[index].key, key) == 0) {
+            field_hint_ = index + 1;
+            return index;
+        }
+    }
+
+    if (strlen(key) > max_key_len_) {
+        return -1;
+    }
+
+    if (field_count_ == params_.max_field_count) {
+        return -1;
+    }
+
+    strcpy(fields_[field_count_].key, key);
+    field_hint_ = field_count_ + 1;
+
+    return field_count_++;
+}
+
+void UdpBeacon::update_schema_() {
+    uint32_t crc = 0;
+
+    for (unsigned n = 0; n < field_count_; ++n) {
+        crc = esp_rom_crc32_le(crc, reinterpret_cast<const uint8_t*>(fields_[n].key),
+                               strlen(fields_[n].key) + 1);
+    }
+
+    schema_ = crc;
+
+    ocs_logi(log_tag, "schema updated: schema=%08lx fields=%u",
+             static_cast<unsigned long>(schema_), field_count_);
+}
+
+status::StatusCode UdpBeacon::send_(size_t size) {
+    if (fd_ < 0) {
+        const auto code = open_();
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    const int ret = sendto(fd_, frame_buf_.get(), size, 0,
+                           reinterpret_cast<const sockaddr*>(&addr_), sizeof(addr_));
+    if (ret < 0) {
+        bonsai_logw(log_tag, "sendto(): errno=%d", errno);
+
+        // The socket is reopened on the next run, e.g. after the network is restored.
+        close_();
+
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode UdpBeacon::open_() {
+    fd_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd_ < 0) {
+        ocs_loge(log_tag, "socket(): errno=%d", errno);
+        return status::StatusCode::Error;
+    }
+
+    const uint8_t ttl = params_.ttl;
+    if (setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) < 0) {
+        ocs_logw(log_tag, "failed to set multicast TTL: errno=%d", errno);
+    }
+
+    const int broadcast = 1;
+    if (setsockopt(fd_, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast)) < 0) {
+        ocs_logw(log_tag, "failed to enable broadcast: errno=%d", errno);
+    }
+
+    return status::StatusCode::OK;
+}
+
+void UdpBeacon::close_() {
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "lwip/sockets.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_scheduler/itask.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_deadband/deadband_filter.h"
+#include "bonsai_net/beacon_frame.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the telemetry to the UDP multicast or broadcast address.
+//!
+//! @remarks
+//!  Each run, the numeric and boolean top-level telemetry fields are sent in a
+//!  single BeaconFrame. The schema, the list of the field names, is learned from
+//!  the telemetry: a field is appended to the schema the first time it's seen.
+//!  If nothing is left after the deadband filter, the frame isn't sent.
+//!  The schema is formatted by the beacon itself, as an IFormatter, so that the
+//!  collector can resolve the field names by the schema identifier.
+class UdpBeacon : public scheduler::ITask,
+                  public fmt::json::IFormatter,
+                  public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Destination IPv4 address, multicast or broadcast.
+        const char* address { nullptr };
+
+        //! Destination UDP port.
+        uint16_t port { 0 };
+
+        //! Multicast TTL.
+        uint8_t ttl { 0 };
+
+        //! Maximum number of fields in the schema.
+        unsigned max_field_count { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p formatter to format the telemetry.
+    //!  - @p filter to drop the insignificant changes, nullptr to report all fields.
+    UdpBeacon(fmt::json::IFormatter& formatter, DeadbandFilter* filter, Params params);
+
+    //! Close the socket.
+    ~UdpBeacon();
+
+    //! Send the telemetry frame.
+    status::StatusCode run() override;
+
+    //! Format the schema.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    static constexpr size_t max_key_len_ = 31;
+
+    struct Field {
+        char key[max_key_len_ + 1];
+    };
+
+    int find_field_(const char* key);
+    void update_schema_();
+
+    status::StatusCode send_(size_t size);
+    status::StatusCode open_();
+    void close_();
+
+    const Params params_;
+
+    fmt::json::IFormatter& formatter_;
+    DeadbandFilter* filter_ { nullptr };
+
+    uint8_t device_id_[BeaconFrame::device_id_size];
+    sockaddr_in addr_;
+    int fd_ { -1 };
+
+    uint32_t seq_ { 0 };
+
+    StaticMutex mu_;
+    std::unique_ptr<Field[]> fields_;
+    unsigned field_count_ { 0 };
+    unsigned field_hint_ { 0 };
+    uint32_t schema_ { 0 };
+
+    std::unique_ptr<float[]> values_;
+    std::unique_ptr<bool[]> present_;
+
+    const size_t frame_size_ { 0 };
+    std::unique_ptr<uint8_t[]> frame_buf_;
+};
+
+} // namespace bonsai
+} // namespace ocs
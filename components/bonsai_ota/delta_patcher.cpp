@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "esp_ota_ops.h"
+#include "freertos/FreeRTOS.h"
+#include "mbedtls/sha256.h"
+
+#include "ocs_core/log.h"
+
+#include "bonsai_ota/delta_patcher.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "delta_patcher";
+
+const char magic[] = { 'B', 'D', 'L', 'T' };
+
+enum Op : uint8_t {
+    OpEnd = 0,
+    OpSeek = 1,
+    OpDiff = 2,
+    OpExtra = 3,
+};
+
+uint32_t read_u32(const uint8_t* buf) {
+    return static_cast<uint32_t>(buf[0]) | (static_cast<uint32_t>(buf[1]) << 8)
+        | (static_cast<uint32_t>(buf[2]) << 16) | (static_cast<uint32_t>(buf[3]) << 24);
+}
+
+} // namespace
+
+DeltaPatcher::DeltaPatcher(OtaSession& session, size_t buffer_size)
+    : session_(session)
+    , buffer_size_(buffer_size) {
+    configASSERT(buffer_size_);
+}
+
+status::StatusCode DeltaPatcher::begin(size_t size) {
+    reset();
+
+    if (size <= header_size) {
+        return fail_(status::StatusCode::InvalidArg, "patch is too short");
+    }
+
+    buf_.reset(new (std::nothrow) uint8_t[buffer_size_]);
+    if (!buf_) {
+        return fail_(status::StatusCode::NoMem, "no memory for buffer");
+    }
+
+    size_ = size;
+    stage_ = Stage::Header;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::write(const void* data, size_t size) {
+    if (stage_ == Stage::Idle || stage_ == Stage::Failed) {
+        return status::StatusCode::InvalidState;
+    }
+
+    if (size > size_ - written_) {
+        return fail_(status::StatusCode::InvalidArg, "data exceeds patch size");
+    }
+
+    const auto code = write_(static_cast<const uint8_t*>(data), size);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    written_ += size;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::finish() {
+    if (stage_ != Stage::End || written_ != size_) {
+        return fail_(status::StatusCode::InvalidArg, "patch is incomplete");
+    }
+
+    auto code = flush_();
+    if (code != status::StatusCode::OK) {
+        return fail_(code, "failed to write image");
+    }
+
+    buf_.reset();
+
+    code = session_.finish();
+    if (code != status::StatusCode::OK) {
+        stage_ = Stage::Failed;
+    }
+
+    return code;
+}
+
+void DeltaPatcher::reset() {
+    buf_.reset();
+    buf_used_ = 0;
+
+    stage_ = Stage::Idle;
+
+    size_ = 0;
+    written_ = 0;
+    header_used_ = 0;
+
+    source_ = nullptr;
+    source_size_ = 0;
+    source_pos_ = 0;
+
+    value_ = 0;
+    shift_ = 0;
+
+    remaining_ = 0;
+    count_ = 0;
+    zeros_ = false;
+}
+
+bool DeltaPatcher::matches(size_t size) const {
+    return stage_ != Stage::Idle && stage_ != Stage::Failed && size_ == size;
+}
+
+bool DeltaPatcher::is_active() const {
+    return stage_ != Stage::Idle;
+}
+
+size_t DeltaPatcher::get_size() const {
+    return size_;
+}
+
+size_t DeltaPatcher::get_written() const {
+    return written_;
+}
+
+status::StatusCode DeltaPatcher::write_(const uint8_t* data, size_t size) {
+    const uint8_t* end = data + size;
+
+    while (data != end) {
+        const size_t avail = end - data;
+
+        switch (stage_) {
+        case Stage::Header: {
+            const size_t n = std::min(header_size - header_used_, avail);
+
+            memcpy(header_ + header_used_, data, n);
+            header_used_ += n;
+            data += n;
+
+            if (header_used_ == header_size) {
+                const auto code = handle_header_();
+                if (code != status::StatusCode::OK) {
+                    return code;
+                }
+            }
+        } break;
+
+        case Stage::Op: {
+            const auto code = handle_op_(*data++);
+            if (code != status::StatusCode::OK) {
+                return code;
+            }
+        } break;
+
+        case Stage::SeekOffset:
+        case Stage::DiffLength:
+        case Stage::DiffZeroCount:
+        case Stage::DiffLiteralCount:
+        case Stage::ExtraLength: {
+            const uint8_t byte = *data++;
+
+            if (shift_ > 63) {
+                return fail_(status::StatusCode::InvalidArg, "invalid varint");
+            }
+
+            value_ |= static_cast<uint64_t>(byte & 0x7f) << shift_;
+            shift_ += 7;
+
+            if (!(byte & 0x80)) {
+                const uint64_t value = value_;
+
+                value_ = 0;
+                shift_ = 0;
+
+                const auto code = handle_value_(value);
+                if (code != status::StatusCode::OK) {
+                    return code;
+                }
+            }
+        } break;
+
+        case Stage::DiffLiterals: {
+            const size_t n = std::min(count_, avail);
+
+            const auto code = copy_source_(n, data);
+            if (code != status::StatusCode::OK) {
+                return code;
+            }
+
+            data += n;
+            count_ -= n;
+            remaining_ -= n;
+
+            if (!count_) {
+                zeros_ = false;
+                stage_ = remaining_ ? Stage::DiffZeroCount : Stage::Op;
+            }
+        } break;
+
+        case Stage::Extra: {
+            const size_t n = std::min(remaining_, avail);
+
+            const auto code = output_(data, n);
+            if (code != status::StatusCode::OK) {
+                return code;
+            }
+
+            data += n;
+            remaining_ -= n;
+
+            if (!remaining_) {
+                stage_ = Stage::Op;
+            }
+        } break;
+
+        default:
+            return fail_(status::StatusCode::InvalidArg, "data after end of patch");
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::handle_header_() {
+    if (memcmp(header_, magic, sizeof(magic)) != 0) {
+        return fail_(status::StatusCode::InvalidArg, "invalid magic");
+    }
+
+    if (header_[4] != version) {
+        return fail_(status::StatusCode::InvalidArg, "unsupported version");
+    }
+
+    source_size_ = read_u32(header_ + 8);
+
+    OtaSession::Params params;
+    params.size = read_u32(header_ + 12);
+    memcpy(params.sha256, header_ + 48, sizeof(params.sha256));
+
+    source_ = esp_ota_get_running_partition();
+    if (!source_) {
+        return fail_(status::StatusCode::Error, "running partition not found");
+    }
+
+    if (source_size_ > source_->size) {
+        return fail_(status::StatusCode::InvalidArg, "source exceeds partition");
+    }
+
+    auto code = verify_source_(header_ + 16);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    code = session_.begin(params);
+    if (code != status::StatusCode::OK) {
+        return fail_(code, "failed to start update");
+    }
+
+    ocs_logi(log_tag, "patch started: source=%s source_size=%u target_size=%u",
+             source_->label, static_cast<unsigned>(source_size_),
+             static_cast<unsigned>(params.size));
+
+    stage_ = Stage::Op;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::verify_source_(const uint8_t* sha256) {
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+
+    for (size_t offset = 0; offset < source_size_;) {
+        const size_t n = std::min(buffer_size_, source_size_ - offset);
+
+        const auto err = esp_partition_read(source_, offset, buf_.get(), n);
+        if (err != ESP_OK) {
+            mbedtls_sha256_free(&ctx);
+
+            ocs_loge(log_tag, "esp_partition_read(): offset=%u err=%s",
+                     static_cast<unsigned>(offset), esp_err_to_name(err));
+
+            return fail_(status::StatusCode::Error, "failed to read source");
+        }
+
+        mbedtls_sha256_update(&ctx, buf_.get(), n);
+        offset += n;
+    }
+
+    uint8_t actual[OtaSession::sha256_size];
+    mbedtls_sha256_finish(&ctx, actual);
+    mbedtls_sha256_free(&ctx);
+
+    if (memcmp(actual, sha256, sizeof(actual)) != 0) {
+        return fail_(status::StatusCode::InvalidArg,
+                     "patch is made for another firmware");
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::handle_op_(uint8_t op) {
+    switch (op) {
+    case OpEnd:
+        stage_ = Stage::End;
+        break;
+
+    case OpSeek:
+        stage_ = Stage::SeekOffset;
+        break;
+
+    case OpDiff:
+        stage_ = Stage::DiffLength;
+        break;
+
+    case OpExtra:
+        stage_ = Stage::ExtraLength;
+        break;
+
+    default:
+        return fail_(status::StatusCode::InvalidArg, "invalid opcode");
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::handle_value_(uint64_t value) {
+    switch (stage_) {
+    case Stage::SeekOffset: {
+        // Zigzag decoding.
+        const int64_t delta =
+            static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        const int64_t pos = static_cast<int64_t>(source_pos_) + delta;
+
+        if (pos < 0 || pos > static_cast<int64_t>(source_size_)) {
+            return fail_(status::StatusCode::InvalidArg, "seek outside of source");
+        }
+
+        source_pos_ = pos;
+        stage_ = Stage::Op;
+    } break;
+
+    case Stage::DiffLength:
+        remaining_ = value;
+        zeros_ = false;
+        stage_ = remaining_ ? Stage::DiffZeroCount : Stage::Op;
+        break;
+
+    case Stage::DiffZeroCount: {
+        if (value > remaining_) {
+            return fail_(status::StatusCode::InvalidArg, "zero run exceeds diff");
+        }
+
+        const auto code = copy_source_(value, nullptr);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+
+        remaining_ -= value;
+        zeros_ = value > 0;
+        stage_ = remaining_ ? Stage::DiffLiteralCount : Stage::Op;
+    } break;
+
+    case Stage::DiffLiteralCount:
+        if (value > remaining_) {
+            return fail_(status::StatusCode::InvalidArg, "literals exceed diff");
+        }
+
+        // Empty runs would never complete the diff.
+        if (!value && !zeros_) {
+            return fail_(status::StatusCode::InvalidArg, "empty diff run");
+        }
+
+        count_ = value;
+
+        if (count_) {
+            stage_ = Stage::DiffLiterals;
+        } else {
+            stage_ = Stage::DiffZeroCount;
+        }
+        break;
+
+    case Stage::ExtraLength:
+        remaining_ = value;
+        stage_ = remaining_ ? Stage::Extra : Stage::Op;
+        break;
+
+    default:
+        return fail_(status::StatusCode::InvalidState, "unexpected value");
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::copy_source_(size_t size, const uint8_t* diff) {
+    if (size > source_size_ - source_pos_) {
+        return fail_(status::StatusCode::InvalidArg, "diff exceeds source");
+    }
+
+    while (size) {
+        if (buf_used_ == buffer_size_) {
+            const auto code = flush_();
+            if (code != status::StatusCode::OK) {
+                return fail_(code, "failed to write image");
+            }
+        }
+
+        const size_t n = std::min(size, buffer_size_ - buf_used_);
+        uint8_t* out = buf_.get() + buf_used_;
+
+        const auto err = esp_partition_read(source_, source_pos_, out, n);
+        if (err != ESP_OK) {
+            ocs_loge(log_tag, "esp_partition_read(): offset=%u err=%s",
+                     static_cast<unsigned>(source_pos_), esp_err_to_name(err));
+
+            return fail_(status::StatusCode::Error, "failed to read source");
+        }
+
+        if (diff) {
+            for (size_t i = 0; i < n; ++i) {
+                out[i] += diff[i];
+            }
+
+            diff += n;
+        }
+
+        buf_used_ += n;
+        source_pos_ += n;
+        size -= n;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::output_(const uint8_t* data, size_t size) {
+    while (size) {
+        if (buf_used_ == buffer_size_) {
+            const auto code = flush_();
+            if (code != status::StatusCode::OK) {
+                return fail_(code, "failed to write image");
+            }
+        }
+
+        const size_t n = std::min(size, buffer_size_ - buf_used_);
+
+        memcpy(buf_.get() + buf_used_, data, n);
+        buf_used_ += n;
+        data += n;
+        size -= n;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode DeltaPatcher::flush_() {
+    if (!buf_used_) {
+        return status::StatusCode::OK;
+    }
+
+    const auto code = session_.write(buf_.get(), buf_used_);
+    buf_used_ = 0;
+
+    return code;
+}
+
+status::StatusCode DeltaPatcher::fail_(status::StatusCode code, const char* reason) {
+    ocs_loge(log_tag, "failed to apply patch: %s: written=%u", reason,
+             static_cast<unsigned>(written_));
+
+    buf_.reset();
+    buf_used_ = 0;
+
+    stage_ = Stage::Failed;
+
+    session_.abort();
+
+    return code;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "esp_partition.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_ota/ota_session.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Reconstruct the firmware image from the running firmware and the delta patch.
+//!
+//! @remarks
+//!  The patch is applied as it arrives: the running firmware is read from flash and
+//!  the reconstructed image is written to the OTA session through the fixed-size
+//!  buffer. The patch is produced by tools/ota_delta.py. All integers are
+//!  little-endian, varints are LEB128.
+//!
+//!  Header, 80 bytes:
+//!   - magic, "BDLT".
+//!   - format version, u8.
+//!   - reserved, 3 bytes.
+//!   - source image size, u32.
+//!   - target image size, u32.
+//!   - source image SHA-256, 32 bytes.
+//!   - target image SHA-256, 32 bytes.
+//!
+//!  Operations, each starts with the opcode byte:
+//!   - end (0): end of the patch.
+//!   - seek (1): move the source position by the zigzag-encoded varint.
+//!   - diff (2): varint length, then the runs of the varint number of zero bytes and
+//!     the varint number of the literal bytes followed by the bytes, until the length
+//!     is covered. Each output byte is the sum of the source byte and the diff byte,
+//!     the source position is advanced by the length.
+//!   - extra (3): varint length, then the bytes copied to the output.
+//!
+//!  The source image is verified with SHA-256 before the target image is started, the
+//!  target image is verified by the OTA session.
+class DeltaPatcher : public core::NonCopyable<> {
+public:
+    //! Patch format version.
+    static constexpr uint8_t version = 1;
+
+    //! Patch header size, in bytes.
+    static constexpr size_t header_size = 80;
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p session to write the reconstructed image.
+    //!  - @p buffer_size - size of the buffer to read the source and to write the
+    //!    target image, in bytes.
+    DeltaPatcher(OtaSession& session, size_t buffer_size);
+
+    //! Start applying the patch of @p size bytes.
+    status::StatusCode begin(size_t size);
+
+    //! Apply the next @p size bytes of the patch.
+    status::StatusCode write(const void* data, size_t size);
+
+    //! Verify the reconstructed image and select it for the next boot.
+    //!
+    //! @notes
+    //!  Should be called when the whole patch is written.
+    status::StatusCode finish();
+
+    //! Stop applying the patch and release the buffer.
+    void reset();
+
+    //! Return true if the patch of @p size bytes is being applied.
+    bool matches(size_t size) const;
+
+    //! Return true if the patch was started.
+    bool is_active() const;
+
+    //! Return the patch size, in bytes.
+    size_t get_size() const;
+
+    //! Return the number of applied patch bytes.
+    size_t get_written() const;
+
+private:
+    enum class Stage : uint8_t {
+        Idle,
+        Header,
+        Op,
+        SeekOffset,
+        DiffLength,
+        DiffZeroCount,
+        DiffLiteralCount,
+        DiffLiterals,
+        ExtraLength,
+        Extra,
+        End,
+        Failed,
+    };
+
+    status::StatusCode write_(const uint8_t* data, size_t size);
+    status::StatusCode handle_header_();
+    status::StatusCode verify_source_(const uint8_t* sha256);
+    status::StatusCode handle_op_(uint8_t op);
+    status::StatusCode handle_value_(uint64_t value);
+    status::StatusCode copy_source_(size_t size, const uint8_t* diff);
+    status::StatusCode output_(const uint8_t* data, size_t size);
+    status::StatusCode flush_();
+    status::StatusCode fail_(status::StatusCode code, const char* reason);
+
+    OtaSession& session_;
+
+    const size_t buffer_size_ { 0 };
+
+    std::unique_ptr<uint8_t[]> buf_;
+    size_t buf_used_ { 0 };
+
+    Stage stage_ { Stage::Idle };
+
+    size_t size_ { 0 };
+    size_t written_ { 0 };
+
+    uint8_t header_[header_size];
+    size_t header_used_ { 0 };
+
+    const esp_partition_t* source_ { nullptr };
+    size_t source_size_ { 0 };
+    size_t source_pos_ { 0 };
+
+    uint64_t value_ { 0 };
+    unsigned shift_ { 0 };
+
+    size_t remaining_ { 0 };
+    size_t count_ { 0 };
+    bool zeros_ { false };
+};
+
+} // namespace bonsai
+} // namespace ocs
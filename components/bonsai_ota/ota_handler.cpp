@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "esp_app_desc.h"
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+#include "ocs_status/macros.h"
+
+#include "bonsai_http/response_ops.h"
+#include "bonsai_ota/ota_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "ota_handler";
+
+// Enough for the size, the offset, the SHA-256 and the reboot flag.
+const size_t max_query_len = 160;
+
+// Number of attempts to receive the data after the socket timeout.
+const unsigned max_recv_retries = 3;
+
+bool parse_size(const char* str, size_t& value) {
+    char* end = nullptr;
+
+    const unsigned long ret = strtoul(str, &end, 10);
+    if (end == str || *end != '\0') {
+        return false;
+    }
+
+    value = ret;
+
+    return true;
+}
+
+bool parse_hex_digit(char c, uint8_t& value) {
+    if (c >= '0' && c <= '9') {
+        value = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        value = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        value = c - 'A' + 10;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool parse_sha256(const char* str, uint8_t* sha256) {
+    if (strlen(str) != OtaSession::sha256_size * 2) {
+        return false;
+    }
+
+    for (size_t n = 0; n < OtaSession::sha256_size; ++n) {
+        uint8_t hi = 0;
+        uint8_t lo = 0;
+
+        if (!parse_hex_digit(str[n * 2], hi) || !parse_hex_digit(str[n * 2 + 1], lo)) {
+            return false;
+        }
+
+        sha256[n] = (hi << 4) | lo;
+    }
+
+    return true;
+}
+
+// Return the error message if the upload query is invalid, sha256 is required only if
+// @p sha256 isn't nullptr.
+const char* parse_query(
+    const char* query, size_t& size, uint8_t* sha256, size_t& offset, bool& reboot) {
+    char value[OtaSession::sha256_size * 2 + 1];
+
+    if (httpd_query_key_value(query, "size", value, sizeof(value)) != ESP_OK
+        || !parse_size(value, size) || !size) {
+        return "invalid size";
+    }
+
+    if (sha256
+        && (httpd_query_key_value(query, "sha256", value, sizeof(value)) != ESP_OK
+            || !parse_sha256(value, sha256))) {
+        return "invalid sha256";
+    }
+
+    if (httpd_query_key_value(query, "offset", value, sizeof(value)) != ESP_OK
+        || !parse_size(value, offset)) {
+        return "invalid offset";
+    }
+
+    reboot = false;
+    if (httpd_query_key_value(query, "reboot", value, sizeof(value)) == ESP_OK) {
+        reboot = strcmp(value, "1") == 0;
+    }
+
+    return nullptr;
+}
+
+// Compare in constant time, so the token can't be guessed by the response time.
+bool equal(const char* a, const char* b, size_t size) {
+    uint8_t diff = 0;
+
+    for (size_t n = 0; n < size; ++n) {
+        diff |= a[n] ^ b[n];
+    }
+
+    return diff == 0;
+}
+
+} // namespace
+
+OtaHandler::OtaHandler(scheduler::ITask& reboot_task,
+                       OtaHealthCheck& health_check,
+                       WebGuiUpdater& web_gui_updater,
+                       const char* token,
+                       size_t chunk_size)
+    : token_(token)
+    , chunk_size_(chunk_size)
+    , reboot_task_(reboot_task)
+    , health_check_(health_check)
+    , web_gui_updater_(web_gui_updater)
+    , patcher_(session_, chunk_size) {
+    configASSERT(token_ && *token_);
+    configASSERT(strlen(token_) <= max_token_len);
+    configASSERT(chunk_size_);
+}
+
+status::StatusCode OtaHandler::handle(httpd_req_t* req) {
+    if (!authorize_(req)) {
+        if (httpd_resp_set_hdr(req, "WWW-Authenticate", "Bearer") != ESP_OK) {
+            return status::StatusCode::Error;
+        }
+
+        return ResponseOps::send_text(req, "401 Unauthorized", "invalid token");
+    }
+
+    if (req->method == HTTP_POST) {
+        if (strncmp(req->uri, delta_path, strlen(delta_path)) == 0) {
+            return handle_delta_upload_(req);
+        }
+
+        if (strncmp(req->uri, web_gui_path, strlen(web_gui_path)) == 0) {
+            return handle_web_gui_upload_(req);
+        }
+
+        return handle_upload_(req);
+    }
+
+    return send_state_(req);
+}
+
+bool OtaHandler::authorize_(httpd_req_t* req) const {
+    const char* prefix = "Bearer ";
+
+    char value[max_token_len + 16];
+    if (httpd_req_get_hdr_value_str(req, "Authorization", value, sizeof(value))
+        != ESP_OK) {
+        return false;
+    }
+
+    if (strncmp(value, prefix, strlen(prefix)) != 0) {
+        return false;
+    }
+
+    const char* token = value + strlen(prefix);
+
+    const size_t len = strlen(token_);
+    if (strlen(token) != len) {
+        return false;
+    }
+
+    return equal(token, token_, len);
+}
+
+status::StatusCode OtaHandler::handle_upload_(httpd_req_t* req) {
+    char query[max_query_len];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        return ResponseOps::send_text(req, HTTPD_400, "invalid query");
+    }
+
+    OtaSession::Params params;
+    size_t offset = 0;
+    bool reboot = false;
+
+    const char* error = parse_query(query, params.size, params.sha256, offset, reboot);
+    if (error) {
+        return ResponseOps::send_text(req, HTTPD_400, error);
+    }
+
+    if (offset == 0) {
+        patcher_.reset();
+        web_gui_updater_.discard();
+
+        const auto code = session_.begin(params);
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_500, "failed to start update");
+        }
+    } else if (!session_.matches(params)
+               || session_.get_state() != OtaSession::State::Receiving) {
+        return ResponseOps::send_text(req, "409 Conflict", "no update to continue");
+    }
+
+    if (offset != session_.get_written()) {
+        char message[48];
+        snprintf(message, sizeof(message), "expected offset %u",
+                 static_cast<unsigned>(session_.get_written()));
+
+        return ResponseOps::send_text(req, "409 Conflict", message);
+    }
+
+    if (req->content_len > params.size - offset) {
+        return ResponseOps::send_text(req, HTTPD_400, "body exceeds image size");
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(receive_(req, Target::Image));
+
+    if (session_.get_written() == params.size) {
+        const auto code = session_.finish();
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_400, "image verification failed");
+        }
+    }
+
+    return complete_upload_(req,
+                            reboot && session_.get_state() == OtaSession::State::Ready);
+}
+
+status::StatusCode OtaHandler::handle_delta_upload_(httpd_req_t* req) {
+    char query[max_query_len];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        return ResponseOps::send_text(req, HTTPD_400, "invalid query");
+    }
+
+    size_t size = 0;
+    size_t offset = 0;
+    bool reboot = false;
+
+    const char* error = parse_query(query, size, nullptr, offset, reboot);
+    if (error) {
+        return ResponseOps::send_text(req, HTTPD_400, error);
+    }
+
+    if (offset == 0) {
+        web_gui_updater_.discard();
+
+        const auto code = patcher_.begin(size);
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_400, "failed to start patch");
+        }
+    } else if (!patcher_.matches(size)) {
+        return ResponseOps::send_text(req, "409 Conflict", "no patch to continue");
+    }
+
+    if (offset != patcher_.get_written()) {
+        char message[48];
+        snprintf(message, sizeof(message), "expected offset %u",
+                 static_cast<unsigned>(patcher_.get_written()));
+
+        return ResponseOps::send_text(req, "409 Conflict", message);
+    }
+
+    if (req->content_len > size - offset) {
+        return ResponseOps::send_text(req, HTTPD_400, "body exceeds patch size");
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(receive_(req, Target::Patch));
+
+    if (patcher_.get_written() == size) {
+        const auto code = patcher_.finish();
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_400, "image verification failed");
+        }
+    }
+
+    return complete_upload_(req,
+                            reboot && session_.get_state() == OtaSession::State::Ready);
+}
+
+status::StatusCode OtaHandler::handle_web_gui_upload_(httpd_req_t* req) {
+    char query[max_query_len];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+        return ResponseOps::send_text(req, HTTPD_400, "invalid query");
+    }
+
+    OtaSession::Params params;
+    size_t offset = 0;
+    bool reboot = false;
+
+    const char* error = parse_query(query, params.size, params.sha256, offset, reboot);
+    if (error) {
+        return ResponseOps::send_text(req, HTTPD_400, error);
+    }
+
+    // The image is staged in the inactive OTA partition, see WebGuiUpdater.
+    if (session_.get_state() == OtaSession::State::Receiving) {
+        return ResponseOps::send_text(req, "409 Conflict", "firmware update in progress");
+    }
+
+    // The inactive OTA partition keeps the firmware to roll back to.
+    if (health_check_.is_pending()) {
+        return ResponseOps::send_text(req, "409 Conflict", "firmware isn't confirmed");
+    }
+
+    if (offset == 0) {
+        const auto code = web_gui_updater_.begin(params);
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_500, "failed to start update");
+        }
+    } else if (!web_gui_updater_.matches(params)
+               || web_gui_updater_.get_state() != OtaSession::State::Receiving) {
+        return ResponseOps::send_text(req, "409 Conflict", "no update to continue");
+    }
+
+    if (offset != web_gui_updater_.get_written()) {
+        char message[48];
+        snprintf(message, sizeof(message), "expected offset %u",
+                 static_cast<unsigned>(web_gui_updater_.get_written()));
+
+        return ResponseOps::send_text(req, "409 Conflict", message);
+    }
+
+    if (req->content_len > params.size - offset) {
+        return ResponseOps::send_text(req, HTTPD_400, "body exceeds image size");
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(receive_(req, Target::WebGui));
+
+    if (web_gui_updater_.get_written() == params.size) {
+        const auto code = web_gui_updater_.finish();
+        if (code != status::StatusCode::OK) {
+            return ResponseOps::send_text(req, HTTPD_400, "image verification failed");
+        }
+    }
+
+    return complete_upload_(
+        req, reboot && web_gui_updater_.get_state() == OtaSession::State::Ready);
+}
+
+status::StatusCode OtaHandler::complete_upload_(httpd_req_t* req, bool reboot) {
+    OCS_STATUS_RETURN_ON_ERROR(send_state_(req));
+
+    if (reboot) {
+        ocs_logi(log_tag, "rebooting to apply the update");
+
+        return reboot_task_.run();
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode OtaHandler::receive_(httpd_req_t* req, Target target) {
+    std::unique_ptr<char[]> buf(new (std::nothrow) char[chunk_size_]);
+    if (!buf) {
+        return status::StatusCode::NoMem;
+    }
+
+    size_t remaining = req->content_len;
+    unsigned retries = 0;
+
+    while (remaining) {
+        const int ret = httpd_req_recv(req, buf.get(), std::min(remaining, chunk_size_));
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT && retries < max_recv_retries) {
+            ++retries;
+            continue;
+        }
+
+        // The written data is kept, the upload can be continued by the next request.
+        if (ret <= 0) {
+            ocs_logw(log_tag, "failed to receive data: ret=%d written=%u", ret,
+                     static_cast<unsigned>(get_written_(target)));
+
+            return status::StatusCode::Error;
+        }
+
+        retries = 0;
+
+        const auto code = write_(target, buf.get(), ret);
+        if (code != status::StatusCode::OK) {
+            ocs_loge(log_tag, "failed to write data: code=%s", status::code_to_str(code));
+
+            return code;
+        }
+
+        remaining -= ret;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode OtaHandler::write_(Target target, const void* data, size_t size) {
+    switch (target) {
+    case Target::Image:
+        return session_.write(data, size);
+
+    case Target::Patch:
+        return patcher_.write(data, size);
+
+    case Target::WebGui:
+        return web_gui_updater_.write(data, size);
+    }
+
+    return status::StatusCode::InvalidArg;
+}
+
+size_t OtaHandler::get_written_(Target target) const {
+    switch (target) {
+    case Target::Image:
+        return session_.get_written();
+
+    case Target::Patch:
+        return patcher_.get_written();
+
+    case Target::WebGui:
+        return web_gui_updater_.get_written();
+    }
+
+    return 0;
+}
+
+status::StatusCode OtaHandler::send_state_(httpd_req_t* req) {
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(format_state_(json.get()));
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+status::StatusCode OtaHandler::format_state_(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_string_ref_cs("state", ota_state_to_str(session_.get_state()))) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("size", session_.get_size())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("written", session_.get_written())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (patcher_.is_active()) {
+        if (!formatter.add_number_cs("patch_size", patcher_.get_size())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("patch_written", patcher_.get_written())) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    if (web_gui_updater_.get_state() != OtaSession::State::Idle) {
+        if (!formatter.add_string_ref_cs(
+                "web_gui_state", ota_state_to_str(web_gui_updater_.get_state()))) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("web_gui_size", web_gui_updater_.get_size())) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("web_gui_written", web_gui_updater_.get_written())) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    if (const esp_partition_t* partition = session_.get_partition(); partition) {
+        if (!formatter.add_string_ref_cs("partition", partition->label)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    if (const esp_partition_t* partition = esp_ota_get_running_partition(); partition) {
+        if (!formatter.add_string_ref_cs("running", partition->label)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    if (!formatter.add_string_ref_cs("version", esp_app_get_description()->version)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_bool_cs("pending_verify", health_check_.is_pending())) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_bool_cs("rollback", esp_ota_check_rollback_is_possible())) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
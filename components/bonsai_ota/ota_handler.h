@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_scheduler/itask.h"
+
+#include "bonsai_http/ihandler.h"
+#include "bonsai_ota/delta_patcher.h"
+#include "bonsai_ota/ota_health_check.h"
+#include "bonsai_ota/ota_session.h"
+#include "bonsai_ota/web_gui_updater.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Upload the firmware image.
+//!
+//! @remarks
+//!  Each request should have the "Authorization: Bearer <token>" header, otherwise
+//!  it's rejected with 401.
+//!
+//!  GET reports the update state as JSON: the session state, the image size, the
+//!  number of written bytes, the target and the running partitions. If the delta
+//!  patch was uploaded, the patch size and the number of applied bytes are reported,
+//!  the same for the web GUI image.
+//!
+//!  POST uploads the part of the image in the request body. Query parameters:
+//!   - size: image size, in bytes.
+//!   - sha256: expected SHA-256 of the image, hex-encoded.
+//!   - offset: offset of the body in the image, 0 starts the new update.
+//!   - reboot=1: reboot into the new firmware when the update is ready.
+//!
+//!  The body is written to flash as it's received. If the connection is lost, the
+//!  written bytes are kept, and the upload is continued by the request with the same
+//!  size and sha256 and the offset equal to the number of written bytes reported
+//!  by GET. The request with the unexpected offset is rejected with 409.
+//!
+//!  When the last byte is written, the image is verified and selected for the next
+//!  boot, see OtaSession.
+//!
+//!  POST to delta_path uploads the delta patch instead of the full image, it's applied
+//!  to the running firmware as it's received, see DeltaPatcher. Query parameters are
+//!  the same, except that size is the patch size and sha256 isn't required, since
+//!  the image SHA-256 is in the patch header. The upload is continued in the same way,
+//!  with the offset equal to the number of applied patch bytes.
+//!
+//!  POST to web_gui_path uploads the web GUI partition image, with the same query
+//!  parameters as the firmware image. The image is applied on the next boot, see
+//!  WebGuiUpdater. It's rejected while the firmware update is in progress or the
+//!  updated firmware isn't confirmed yet, and it's discarded when the firmware update
+//!  is started.
+class OtaHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Path to get the update state and to upload the full image.
+    static constexpr const char* path = "/api/v1/ota";
+
+    //! Path to upload the delta patch.
+    static constexpr const char* delta_path = "/api/v1/ota/delta";
+
+    //! Path to upload the web GUI image.
+    static constexpr const char* web_gui_path = "/api/v1/ota/web_gui";
+
+    //! Maximum length of the access token.
+    static constexpr size_t max_token_len = 64;
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p reboot_task to reboot into the new firmware.
+    //!  - @p health_check to report if the running firmware is confirmed.
+    //!  - @p web_gui_updater to stage the web GUI image.
+    //!  - @p token - access token, should be valid during the handler lifetime.
+    //!  - @p chunk_size - size of the buffer to receive the image, and of the buffer
+    //!    to reconstruct the image from the delta patch, in bytes.
+    OtaHandler(scheduler::ITask& reboot_task,
+               OtaHealthCheck& health_check,
+               WebGuiUpdater& web_gui_updater,
+               const char* token,
+               size_t chunk_size);
+
+    //! Handle the GET and POST requests.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    enum class Target {
+        Image,
+        Patch,
+        WebGui,
+    };
+
+    bool authorize_(httpd_req_t* req) const;
+
+    status::StatusCode handle_upload_(httpd_req_t* req);
+    status::StatusCode handle_delta_upload_(httpd_req_t* req);
+    status::StatusCode handle_web_gui_upload_(httpd_req_t* req);
+    status::StatusCode complete_upload_(httpd_req_t* req, bool reboot);
+    status::StatusCode receive_(httpd_req_t* req, Target target);
+    status::StatusCode write_(Target target, const void* data, size_t size);
+    size_t get_written_(Target target) const;
+    status::StatusCode send_state_(httpd_req_t* req);
+    status::StatusCode format_state_(cJSON* json);
+
+    const char* token_ { nullptr };
+    const size_t chunk_size_ { 0 };
+
+    scheduler::ITask& reboot_task_;
+    OtaHealthCheck& health_check_;
+    WebGuiUpdater& web_gui_updater_;
+
+    OtaSession session_;
+    DeltaPatcher patcher_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "esp_ota_ops.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "ocs_core/log.h"
+
+#include "bonsai_ota/ota_health_check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "ota_health_check";
+
+} // namespace
+
+OtaHealthCheck::OtaHealthCheck(core::IClock& clock, Params params)
+    : params_(params)
+    , clock_(clock)
+    , start_(clock.now()) {
+    configASSERT(params_.confirm_delay > 0);
+    configASSERT(params_.check_interval >= core::Duration::millisecond);
+    configASSERT(params_.connect_timeout >= params_.confirm_delay);
+
+    const esp_partition_t* partition = esp_ota_get_running_partition();
+    configASSERT(partition);
+
+    esp_ota_img_states_t state = ESP_OTA_IMG_UNDEFINED;
+
+    const auto err = esp_ota_get_state_partition(partition, &state);
+    if (err != ESP_OK) {
+        // The factory partition has no OTA state.
+        if (err != ESP_ERR_NOT_SUPPORTED) {
+            ocs_logw(log_tag, "esp_ota_get_state_partition(): partition=%s err=%s",
+                     partition->label, esp_err_to_name(err));
+        }
+
+        return;
+    }
+
+    if (state == ESP_OTA_IMG_PENDING_VERIFY) {
+        ocs_logw(log_tag, "firmware isn't confirmed yet: partition=%s",
+                 partition->label);
+
+        pending_ = true;
+    }
+}
+
+bool OtaHealthCheck::is_pending() const {
+    return pending_;
+}
+
+status::StatusCode OtaHealthCheck::run() {
+    const TickType_t interval =
+        pdMS_TO_TICKS(params_.check_interval / core::Duration::millisecond);
+
+    auto code = status::StatusCode::OK;
+
+    // The failed confirmation is retried on the next check.
+    while (pending_) {
+        code = check_();
+
+        if (pending_) {
+            vTaskDelay(interval);
+        }
+    }
+
+    return code;
+}
+
+status::StatusCode OtaHealthCheck::check_() {
+    const core::Time uptime = clock_.now() - start_;
+
+    if (connected_ && uptime >= params_.confirm_delay) {
+        const auto err = esp_ota_mark_app_valid_cancel_rollback();
+        if (err != ESP_OK) {
+            ocs_loge(log_tag, "esp_ota_mark_app_valid_cancel_rollback(): %s",
+                     esp_err_to_name(err));
+
+            return status::StatusCode::Error;
+        }
+
+        pending_ = false;
+
+        ocs_logi(log_tag, "firmware confirmed");
+
+        return status::StatusCode::OK;
+    }
+
+    if (uptime >= params_.connect_timeout) {
+        ocs_loge(log_tag, "network isn't connected in time, rolling back");
+
+        const auto err = esp_ota_mark_app_invalid_rollback_and_reboot();
+
+        // Only returns if there is no firmware to roll back to.
+        ocs_loge(log_tag, "esp_ota_mark_app_invalid_rollback_and_reboot(): %s",
+                 esp_err_to_name(err));
+
+        pending_ = false;
+
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+void OtaHealthCheck::handle_connect() {
+    connected_ = true;
+}
+
+void OtaHealthCheck::handle_disconnect() {
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_net/inetwork_handler.h"
+#include "ocs_scheduler/itask.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Confirm or roll back the updated firmware after boot.
+//!
+//! @remarks
+//!  The firmware booted for the first time after the update is considered healthy if
+//!  the network is connected and the firmware keeps running for the configured time
+//!  after that. Then the image is marked valid and the rollback is cancelled.
+//!
+//!  If the network isn't connected in time, the image is marked invalid and the chip
+//!  is rebooted into the previous firmware. If the firmware crashes before it's marked
+//!  valid, the bootloader rolls back on the next boot.
+//!
+//!  The check is run in the dedicated task, which returns as soon as the firmware is
+//!  confirmed or rolled back, see OneshotTask, so nothing is left running afterwards.
+class OtaHealthCheck : public scheduler::ITask,
+                       public net::INetworkHandler,
+                       public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Time since boot in which the network should be connected.
+        core::Time connect_timeout { 0 };
+
+        //! Time since boot after which the connected firmware is considered healthy.
+        core::Time confirm_delay { 0 };
+
+        //! Interval between the checks.
+        core::Time check_interval { 0 };
+    };
+
+    //! Initialize.
+    OtaHealthCheck(core::IClock& clock, Params params);
+
+    //! Return true if the running firmware isn't confirmed yet.
+    bool is_pending() const;
+
+    //! Block until the firmware is confirmed or rolled back.
+    status::StatusCode run() override;
+
+    //! Remember the network is connected.
+    void handle_connect() override;
+
+    //! Nothing to do, the firmware is allowed to lose the network once connected.
+    void handle_disconnect() override;
+
+private:
+    status::StatusCode check_();
+
+    const Params params_;
+
+    core::IClock& clock_;
+
+    const core::Time start_ { 0 };
+
+    std::atomic<bool> pending_ { false };
+    std::atomic<bool> connected_ { false };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_ota/ota_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "ota_pipeline";
+
+} // namespace
+
+OtaPipeline::OtaPipeline(core::IClock& clock,
+                         net::FanoutNetworkHandler& network_handler,
+                         scheduler::ITask& reboot_task,
+                         http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_OTA_ENABLE
+    static_assert(sizeof(CONFIG_BONSAI_FIRMWARE_OTA_TOKEN) > 1,
+                  "CONFIG_BONSAI_FIRMWARE_OTA_TOKEN should be set");
+    static_assert(sizeof(CONFIG_BONSAI_FIRMWARE_OTA_TOKEN)
+                      <= OtaHandler::max_token_len + 1,
+                  "CONFIG_BONSAI_FIRMWARE_OTA_TOKEN is too long");
+
+    health_check_.reset(new (std::nothrow) OtaHealthCheck(
+        clock,
+        OtaHealthCheck::Params {
+            .connect_timeout = core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_OTA_HEALTH_CHECK_CONNECT_TIMEOUT,
+            .confirm_delay = core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_OTA_HEALTH_CHECK_CONFIRM_DELAY,
+            .check_interval = core::Duration::second,
+        }));
+    configASSERT(health_check_);
+
+#ifdef CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+    if (health_check_->is_pending()) {
+        network_handler.add(*health_check_);
+
+        health_check_task_.reset(new (std::nothrow) OneshotTask(
+            *health_check_, "ota_health_check",
+            OneshotTask::Params {
+                .stack_size = CONFIG_BONSAI_FIRMWARE_OTA_HEALTH_CHECK_STACK_SIZE,
+                .priority = tskIDLE_PRIORITY + 1,
+            }));
+        configASSERT(health_check_task_);
+    }
+#else
+    (void)network_handler;
+#endif // CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+
+    web_gui_updater_.reset(
+        new (std::nothrow) WebGuiUpdater(CONFIG_BONSAI_FIRMWARE_OTA_CHUNK_SIZE));
+    configASSERT(web_gui_updater_);
+
+    if (const auto code = web_gui_updater_->apply(); code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "failed to apply web GUI update: code=%s",
+                 status::code_to_str(code));
+    }
+
+    handler_.reset(new (std::nothrow) OtaHandler(
+        reboot_task, *health_check_, *web_gui_updater_, CONFIG_BONSAI_FIRMWARE_OTA_TOKEN,
+        CONFIG_BONSAI_FIRMWARE_OTA_CHUNK_SIZE));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, OtaHandler::path, [this](httpd_req_t* req) {
+        return handler_->handle(req);
+    });
+    router.add(http::IRouter::Method::Post, OtaHandler::path, [this](httpd_req_t* req) {
+        return handler_->handle(req);
+    });
+    router.add(http::IRouter::Method::Post, OtaHandler::delta_path,
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+    router.add(http::IRouter::Method::Post, OtaHandler::web_gui_path,
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)clock;
+    (void)network_handler;
+    (void)reboot_task;
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_OTA_ENABLE
+}
+
+status::StatusCode OtaPipeline::start() {
+    if (health_check_task_) {
+        return health_check_task_->start();
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+#include "ocs_net/fanout_network_handler.h"
+#include "ocs_scheduler/itask.h"
+
+#include "bonsai_core/oneshot_task.h"
+#include "bonsai_ota/ota_handler.h"
+#include "bonsai_ota/ota_health_check.h"
+#include "bonsai_ota/web_gui_updater.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Firmware update over HTTP.
+//!
+//! @remarks
+//!  The image is uploaded via POST /api/v1/ota, or as the delta patch to the running
+//!  firmware via POST /api/v1/ota/delta, and the update state is available via
+//!  GET /api/v1/ota, see OtaHandler. The web GUI image is
+//!  uploaded via POST /api/v1/ota/web_gui and applied by the pipeline constructor on
+//!  the next boot, so the pipeline should be created before the web GUI is mounted.
+//!
+//!  If CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE is enabled, the updated firmware is
+//!  confirmed or rolled back after boot, see OtaHealthCheck. The health check task is
+//!  started only if the running firmware isn't confirmed yet.
+//!
+//!  All requests require the access token, see OtaHandler.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_OTA_ENABLE is disabled, the endpoints aren't registered.
+class OtaPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    OtaPipeline(core::IClock& clock,
+                net::FanoutNetworkHandler& network_handler,
+                scheduler::ITask& reboot_task,
+                http::IRouter& router);
+
+    //! Start the health check, if the running firmware isn't confirmed yet.
+    status::StatusCode start();
+
+private:
+    std::unique_ptr<OtaHealthCheck> health_check_;
+    std::unique_ptr<OneshotTask> health_check_task_;
+    std::unique_ptr<WebGuiUpdater> web_gui_updater_;
+    std::unique_ptr<OtaHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
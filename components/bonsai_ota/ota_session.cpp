@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "ocs_core/log.h"
+
+#include "bonsai_ota/ota_session.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "ota_session";
+
+} // namespace
+
+OtaSession::OtaSession() {
+    memset(params_.sha256, 0, sizeof(params_.sha256));
+
+    mbedtls_sha256_init(&sha256_);
+}
+
+OtaSession::~OtaSession() {
+    release_();
+
+    mbedtls_sha256_free(&sha256_);
+}
+
+status::StatusCode OtaSession::begin(const Params& params) {
+    release_();
+
+    params_ = params;
+    written_ = 0;
+
+    partition_ = esp_ota_get_next_update_partition(nullptr);
+    if (!partition_) {
+        ocs_loge(log_tag, "no partition for the update");
+
+        abort();
+        return status::StatusCode::Error;
+    }
+
+    if (params_.size > partition_->size) {
+        ocs_loge(log_tag, "image doesn't fit into partition: partition=%s size=%u max=%u",
+                 partition_->label, static_cast<unsigned>(params_.size),
+                 static_cast<unsigned>(partition_->size));
+
+        abort();
+        return status::StatusCode::InvalidArg;
+    }
+
+    // The flash is erased sector by sector while writing, to not block the system
+    // for the whole partition erase.
+    const auto err = esp_ota_begin(partition_, OTA_WITH_SEQUENTIAL_WRITES, &handle_);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_ota_begin(): partition=%s err=%s", partition_->label,
+                 esp_err_to_name(err));
+
+        abort();
+        return status::StatusCode::Error;
+    }
+
+    mbedtls_sha256_starts(&sha256_, 0);
+
+    state_ = State::Receiving;
+
+    ocs_logi(log_tag, "update started: partition=%s size=%u", partition_->label,
+             static_cast<unsigned>(params_.size));
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode OtaSession::write(const void* data, size_t size) {
+    if (state_ != State::Receiving) {
+        return status::StatusCode::InvalidState;
+    }
+
+    if (size > params_.size - written_) {
+        ocs_loge(log_tag, "data exceeds image size: size=%u written=%u max=%u",
+                 static_cast<unsigned>(size), static_cast<unsigned>(written_),
+                 static_cast<unsigned>(params_.size));
+
+        abort();
+        return status::StatusCode::InvalidArg;
+    }
+
+    const auto err = esp_ota_write(handle_, data, size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_ota_write(): written=%u err=%s",
+                 static_cast<unsigned>(written_), esp_err_to_name(err));
+
+        abort();
+        return status::StatusCode::Error;
+    }
+
+    mbedtls_sha256_update(&sha256_, static_cast<const unsigned char*>(data), size);
+    written_ += size;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode OtaSession::finish() {
+    if (state_ != State::Receiving || written_ != params_.size) {
+        return status::StatusCode::InvalidState;
+    }
+
+    uint8_t sha256[sha256_size];
+    mbedtls_sha256_finish(&sha256_, sha256);
+
+    if (memcmp(sha256, params_.sha256, sizeof(sha256)) != 0) {
+        ocs_loge(log_tag, "SHA-256 mismatch: size=%u", static_cast<unsigned>(written_));
+
+        abort();
+        return status::StatusCode::InvalidArg;
+    }
+
+    // Validates the image, including the signature if the signed app verification is
+    // enabled.
+    auto err = esp_ota_end(handle_);
+    handle_ = 0;
+
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_ota_end(): %s", esp_err_to_name(err));
+
+        abort();
+        return err == ESP_ERR_OTA_VALIDATE_FAILED ? status::StatusCode::InvalidArg
+                                                  : status::StatusCode::Error;
+    }
+
+    err = esp_ota_set_boot_partition(partition_);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_ota_set_boot_partition(): partition=%s err=%s",
+                 partition_->label, esp_err_to_name(err));
+
+        abort();
+        return status::StatusCode::Error;
+    }
+
+    state_ = State::Ready;
+
+    ocs_logi(log_tag, "update ready: partition=%s size=%u", partition_->label,
+             static_cast<unsigned>(written_));
+
+    return status::StatusCode::OK;
+}
+
+void OtaSession::abort() {
+    release_();
+
+    state_ = State::Failed;
+}
+
+bool OtaSession::matches(const Params& params) const {
+    return state_ != State::Idle && params_.size == params.size
+        && memcmp(params_.sha256, params.sha256, sizeof(params_.sha256)) == 0;
+}
+
+OtaSession::State OtaSession::get_state() const {
+    return state_;
+}
+
+size_t OtaSession::get_size() const {
+    return params_.size;
+}
+
+size_t OtaSession::get_written() const {
+    return written_;
+}
+
+const esp_partition_t* OtaSession::get_partition() const {
+    return partition_;
+}
+
+void OtaSession::release_() {
+    if (handle_) {
+        esp_ota_abort(handle_);
+        handle_ = 0;
+    }
+}
+
+const char* ota_state_to_str(OtaSession::State state) {
+    switch (state) {
+    case OtaSession::State::Idle:
+        return "idle";
+    case OtaSession::State::Receiving:
+        return "receiving";
+    case OtaSession::State::Ready:
+        return "ready";
+    case OtaSession::State::Failed:
+        return "failed";
+    }
+
+    return "<none>";
+}
+
+} // namespace bonsai
+} // namespace ocs
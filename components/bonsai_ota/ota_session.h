@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_ota_ops.h"
+#include "mbedtls/sha256.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Write the firmware image into the inactive OTA partition.
+//!
+//! @remarks
+//!  The image is written to flash as it arrives, it's never buffered in RAM. The
+//!  number of written bytes is kept between the writes, so the interrupted upload can
+//!  be continued from the last written byte.
+//!
+//!  When the whole image is written, its SHA-256 is compared with the expected one,
+//!  and the image is validated by the bootloader support library, which includes the
+//!  signature check if the signed app verification is enabled in the project config.
+//!  Only then the partition is selected for the next boot.
+class OtaSession : public core::NonCopyable<> {
+public:
+    //! SHA-256 digest size, in bytes.
+    static constexpr size_t sha256_size = 32;
+
+    //! Session state.
+    enum class State {
+        //! No update in progress.
+        Idle,
+
+        //! Image is being received.
+        Receiving,
+
+        //! Image is verified and selected for the next boot.
+        Ready,
+
+        //! Image is rejected.
+        Failed,
+    };
+
+    //! Image parameters.
+    struct Params {
+        //! Image size, in bytes.
+        size_t size { 0 };
+
+        //! Expected SHA-256 of the image.
+        uint8_t sha256[sha256_size];
+    };
+
+    //! Initialize.
+    OtaSession();
+
+    //! Abort the update in progress.
+    ~OtaSession();
+
+    //! Start the new update, the previous one is aborted.
+    status::StatusCode begin(const Params& params);
+
+    //! Write the next @p size bytes of the image.
+    //!
+    //! @remarks
+    //!  The update is failed if the data doesn't fit into the image or the partition.
+    status::StatusCode write(const void* data, size_t size);
+
+    //! Verify the written image and select it for the next boot.
+    //!
+    //! @notes
+    //!  Should be called when the whole image is written.
+    status::StatusCode finish();
+
+    //! Fail the update in progress.
+    void abort();
+
+    //! Return true if the session was started with @p params.
+    bool matches(const Params& params) const;
+
+    //! Return the session state.
+    State get_state() const;
+
+    //! Return the image size, in bytes.
+    size_t get_size() const;
+
+    //! Return the number of written bytes.
+    size_t get_written() const;
+
+    //! Return the partition the image is written to.
+    const esp_partition_t* get_partition() const;
+
+private:
+    void release_();
+
+    State state_ { State::Idle };
+    Params params_;
+
+    const esp_partition_t* partition_ { nullptr };
+    esp_ota_handle_t handle_ { 0 };
+
+    size_t written_ { 0 };
+    mbedtls_sha256_context sha256_;
+};
+
+//! Return the human-readable name of @p state.
+const char* ota_state_to_str(OtaSession::State state);
+
+} // namespace bonsai
+} // namespace ocs
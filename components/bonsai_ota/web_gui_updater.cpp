@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "esp_image_format.h"
+#include "esp_ota_ops.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/macros.h"
+
+#include "bonsai_ota/web_gui_updater.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "web_gui_updater";
+
+// Should match the web GUI partition in partitions.csv.
+const char* partition_label = "web_gui";
+
+// Changing the record layout should change the magic.
+const uint32_t record_magic = 0x42574731;
+
+size_t align_up(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+WebGuiUpdater::WebGuiUpdater(size_t buffer_size)
+    : buffer_size_(buffer_size) {
+    configASSERT(buffer_size_);
+
+    memset(params_.sha256, 0, sizeof(params_.sha256));
+
+    mbedtls_sha256_init(&sha256_);
+
+    if (!locate_()) {
+        ocs_logw(log_tag, "web GUI update isn't available");
+    }
+}
+
+WebGuiUpdater::~WebGuiUpdater() {
+    mbedtls_sha256_free(&sha256_);
+}
+
+status::StatusCode WebGuiUpdater::apply() {
+    if (!staging_) {
+        return status::StatusCode::OK;
+    }
+
+    Record record;
+    if (!read_record_(record)) {
+        return status::StatusCode::OK;
+    }
+
+    ocs_logi(log_tag, "applying staged image: staging=%s partition=%s size=%u",
+             staging_->label, web_gui_->label, static_cast<unsigned>(record.size));
+
+    OCS_STATUS_RETURN_ON_ERROR(copy_(record));
+
+    erase_record_();
+
+    ocs_logi(log_tag, "web GUI updated: size=%u", static_cast<unsigned>(record.size));
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::begin(const OtaSession::Params& params) {
+    if (!staging_) {
+        return fail_();
+    }
+
+    // The staging area belongs to the firmware which will be booted next.
+    if (staging_ == esp_ota_get_boot_partition()) {
+        ocs_loge(log_tag, "firmware update is pending: partition=%s", staging_->label);
+
+        state_ = OtaSession::State::Failed;
+        return status::StatusCode::InvalidState;
+    }
+
+    if (params.size > web_gui_->size) {
+        ocs_loge(log_tag, "image doesn't fit: size=%u partition_size=%u",
+                 static_cast<unsigned>(params.size),
+                 static_cast<unsigned>(web_gui_->size));
+
+        state_ = OtaSession::State::Failed;
+        return status::StatusCode::InvalidArg;
+    }
+
+    // The previous record is discarded, the sector is prepared for the new one.
+    const auto err =
+        esp_partition_erase_range(staging_, record_offset_, staging_->erase_size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_erase_range(): record err=%s",
+                 esp_err_to_name(err));
+
+        return fail_();
+    }
+
+    params_ = params;
+    written_ = 0;
+    erased_ = 0;
+
+    if (invalidate_rollback_() != status::StatusCode::OK) {
+        return fail_();
+    }
+
+    mbedtls_sha256_starts(&sha256_, 0);
+
+    state_ = OtaSession::State::Receiving;
+
+    ocs_logi(log_tag, "update started: staging=%s size=%u", staging_->label,
+             static_cast<unsigned>(params_.size));
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::write(const void* data, size_t size) {
+    if (state_ != OtaSession::State::Receiving) {
+        return status::StatusCode::InvalidState;
+    }
+
+    if (size > params_.size - written_) {
+        ocs_loge(log_tag, "data exceeds image: size=%u written=%u image_size=%u",
+                 static_cast<unsigned>(size), static_cast<unsigned>(written_),
+                 static_cast<unsigned>(params_.size));
+
+        fail_();
+        return status::StatusCode::InvalidArg;
+    }
+
+    const size_t end = written_ + size;
+
+    if (end > erased_) {
+        const size_t erase_end = align_up(end, staging_->erase_size);
+
+        const auto err = esp_partition_erase_range(staging_, image_offset_ + erased_,
+                                                   erase_end - erased_);
+        if (err != ESP_OK) {
+            ocs_loge(log_tag, "esp_partition_erase_range(): offset=%u err=%s",
+                     static_cast<unsigned>(erased_), esp_err_to_name(err));
+
+            return fail_();
+        }
+
+        erased_ = erase_end;
+    }
+
+    const auto err = esp_partition_write(staging_, image_offset_ + written_, data, size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_write(): written=%u err=%s",
+                 static_cast<unsigned>(written_), esp_err_to_name(err));
+
+        return fail_();
+    }
+
+    mbedtls_sha256_update(&sha256_, static_cast<const unsigned char*>(data), size);
+    written_ = end;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::finish() {
+    if (state_ != OtaSession::State::Receiving || written_ != params_.size) {
+        return status::StatusCode::InvalidState;
+    }
+
+    uint8_t sha256[OtaSession::sha256_size];
+    mbedtls_sha256_finish(&sha256_, sha256);
+
+    if (memcmp(sha256, params_.sha256, sizeof(sha256)) != 0) {
+        ocs_loge(log_tag, "SHA-256 mismatch: size=%u", static_cast<unsigned>(written_));
+
+        fail_();
+        return status::StatusCode::InvalidArg;
+    }
+
+    const auto code = hash_(staging_, image_offset_, written_, sha256);
+    if (code != status::StatusCode::OK) {
+        fail_();
+        return code;
+    }
+
+    if (memcmp(sha256, params_.sha256, sizeof(sha256)) != 0) {
+        ocs_loge(log_tag, "flash verification failed: size=%u",
+                 static_cast<unsigned>(written_));
+
+        return fail_();
+    }
+
+    Record record;
+    memset(&record, 0, sizeof(record));
+
+    record.magic = record_magic;
+    record.size = written_;
+    memcpy(record.sha256, params_.sha256, sizeof(record.sha256));
+    record.crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&record),
+                                  offsetof(Record, crc));
+
+    // The record sector is erased when the update is started.
+    const auto err =
+        esp_partition_write(staging_, record_offset_, &record, sizeof(record));
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_write(): record err=%s", esp_err_to_name(err));
+
+        return fail_();
+    }
+
+    state_ = OtaSession::State::Ready;
+
+    ocs_logi(log_tag, "update ready, applied on next boot: size=%u",
+             static_cast<unsigned>(written_));
+
+    return status::StatusCode::OK;
+}
+
+void WebGuiUpdater::discard() {
+    if (staging_) {
+        Record record;
+
+        const auto err =
+            esp_partition_read(staging_, record_offset_, &record, sizeof(record));
+        if (err == ESP_OK && record.magic == record_magic) {
+            ocs_logi(log_tag, "staged image discarded");
+
+            erase_record_();
+        }
+    }
+
+    state_ = OtaSession::State::Idle;
+    written_ = 0;
+    erased_ = 0;
+}
+
+bool WebGuiUpdater::matches(const OtaSession::Params& params) const {
+    return state_ != OtaSession::State::Idle && params_.size == params.size
+        && memcmp(params_.sha256, params.sha256, sizeof(params_.sha256)) == 0;
+}
+
+OtaSession::State WebGuiUpdater::get_state() const {
+    return state_;
+}
+
+size_t WebGuiUpdater::get_size() const {
+    return params_.size;
+}
+
+size_t WebGuiUpdater::get_written() const {
+    return written_;
+}
+
+bool WebGuiUpdater::locate_() {
+    web_gui_ = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_DATA_SPIFFS, partition_label);
+    if (!web_gui_) {
+        ocs_logw(log_tag, "partition not found: label=%s", partition_label);
+        return false;
+    }
+
+    const esp_partition_t* staging = esp_ota_get_next_update_partition(nullptr);
+    if (!staging) {
+        ocs_logw(log_tag, "no OTA partition to stage the image");
+        return false;
+    }
+
+    const size_t sector_size = staging->erase_size;
+    const size_t region_size = align_up(web_gui_->size, sector_size);
+
+    if (staging->size < region_size + sector_size) {
+        ocs_logw(log_tag, "OTA partition is too small: partition=%s size=%u",
+                 staging->label, static_cast<unsigned>(staging->size));
+        return false;
+    }
+
+    staging_ = staging;
+    record_offset_ = staging_->size - sector_size;
+    image_offset_ = record_offset_ - region_size;
+
+    return true;
+}
+
+status::StatusCode WebGuiUpdater::invalidate_rollback_() {
+    esp_ota_img_states_t state = ESP_OTA_IMG_UNDEFINED;
+
+    // The partition isn't referenced by the OTA data, the bootloader never selects it.
+    if (esp_ota_get_state_partition(staging_, &state) != ESP_OK
+        || state == ESP_OTA_IMG_INVALID || state == ESP_OTA_IMG_ABORTED) {
+        return status::StatusCode::OK;
+    }
+
+    const esp_partition_pos_t pos {
+        .offset = staging_->address,
+        .size = staging_->size,
+    };
+
+    esp_image_metadata_t metadata;
+
+    if (esp_image_get_metadata(&pos, &metadata) == ESP_OK
+        && metadata.image_len <= image_offset_) {
+        return status::StatusCode::OK;
+    }
+
+    ocs_logw(log_tag, "staging area overlaps rollback firmware, invalidating it: "
+             "partition=%s",
+             staging_->label);
+
+    // Erases both the firmware and its OTA data entry, the partition is referenced by
+    // the inactive entry, since it isn't the running one.
+    const auto err = esp_ota_erase_last_boot_app_partition();
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_ota_erase_last_boot_app_partition(): err=%s",
+                 esp_err_to_name(err));
+
+        return status::StatusCode::Error;
+    }
+
+    erased_ = record_offset_ - image_offset_;
+
+    return status::StatusCode::OK;
+}
+
+bool WebGuiUpdater::read_record_(Record& record) {
+    const auto err =
+        esp_partition_read(staging_, record_offset_, &record, sizeof(record));
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_read(): record err=%s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (record.magic != record_magic) {
+        return false;
+    }
+
+    const uint32_t crc = esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&record),
+                                          offsetof(Record, crc));
+
+    if (record.crc != crc || !record.size || record.size > web_gui_->size) {
+        ocs_logw(log_tag, "invalid record: size=%u", static_cast<unsigned>(record.size));
+
+        erase_record_();
+        return false;
+    }
+
+    return true;
+}
+
+void WebGuiUpdater::erase_record_() {
+    const auto err =
+        esp_partition_erase_range(staging_, record_offset_, staging_->erase_size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_erase_range(): record err=%s",
+                 esp_err_to_name(err));
+    }
+}
+
+status::StatusCode WebGuiUpdater::hash_(const esp_partition_t* partition,
+                                        size_t offset,
+                                        size_t size,
+                                        uint8_t* sha256) {
+    std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[buffer_size_]);
+    if (!buf) {
+        return status::StatusCode::NoMem;
+    }
+
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+
+    for (size_t pos = 0; pos < size;) {
+        const size_t n = std::min(buffer_size_, size - pos);
+
+        const auto err = esp_partition_read(partition, offset + pos, buf.get(), n);
+        if (err != ESP_OK) {
+            mbedtls_sha256_free(&ctx);
+
+            ocs_loge(log_tag, "esp_partition_read(): partition=%s offset=%u err=%s",
+                     partition->label, static_cast<unsigned>(offset + pos),
+                     esp_err_to_name(err));
+
+            return status::StatusCode::Error;
+        }
+
+        mbedtls_sha256_update(&ctx, buf.get(), n);
+        pos += n;
+    }
+
+    mbedtls_sha256_finish(&ctx, sha256);
+    mbedtls_sha256_free(&ctx);
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::copy_(const Record& record) {
+    uint8_t sha256[OtaSession::sha256_size];
+
+    OCS_STATUS_RETURN_ON_ERROR(hash_(staging_, image_offset_, record.size, sha256));
+
+    // The staged image can't become valid, don't try it again.
+    if (memcmp(sha256, record.sha256, sizeof(sha256)) != 0) {
+        ocs_loge(log_tag, "staged image is corrupted: size=%u",
+                 static_cast<unsigned>(record.size));
+
+        erase_record_();
+        return status::StatusCode::Error;
+    }
+
+    std::unique_ptr<uint8_t[]> image(new (std::nothrow) uint8_t[buffer_size_]);
+    std::unique_ptr<uint8_t[]> current(new (std::nothrow) uint8_t[buffer_size_]);
+    if (!image || !current) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (size_t offset = 0; offset < web_gui_->size; offset += web_gui_->erase_size) {
+        OCS_STATUS_RETURN_ON_ERROR(
+            copy_sector_(record, offset, image.get(), current.get()));
+    }
+
+    image.reset();
+    current.reset();
+
+    OCS_STATUS_RETURN_ON_ERROR(hash_(web_gui_, 0, record.size, sha256));
+
+    // The record is kept, the copy is repeated on the next boot.
+    if (memcmp(sha256, record.sha256, sizeof(sha256)) != 0) {
+        ocs_loge(log_tag, "web GUI verification failed: size=%u",
+                 static_cast<unsigned>(record.size));
+
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::copy_sector_(const Record& record,
+                                               size_t offset,
+                                               uint8_t* image,
+                                               uint8_t* current) {
+    const size_t end = std::min<size_t>(offset + web_gui_->erase_size, web_gui_->size);
+
+    bool equal = true;
+
+    for (size_t pos = offset; pos < end && equal;) {
+        const size_t n = std::min(buffer_size_, end - pos);
+
+        OCS_STATUS_RETURN_ON_ERROR(read_image_(record, pos, image, n));
+        OCS_STATUS_RETURN_ON_ERROR(read_(web_gui_, pos, current, n));
+
+        equal = memcmp(image, current, n) == 0;
+        pos += n;
+    }
+
+    // Already copied, e.g. by the interrupted attempt.
+    if (equal) {
+        return status::StatusCode::OK;
+    }
+
+    auto err = esp_partition_erase_range(web_gui_, offset, end - offset);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_erase_range(): offset=%u err=%s",
+                 static_cast<unsigned>(offset), esp_err_to_name(err));
+
+        return status::StatusCode::Error;
+    }
+
+    const size_t image_end = std::min<size_t>(end, record.size);
+
+    for (size_t pos = offset; pos < image_end;) {
+        const size_t n = std::min(buffer_size_, image_end - pos);
+
+        OCS_STATUS_RETURN_ON_ERROR(read_image_(record, pos, image, n));
+
+        err = esp_partition_write(web_gui_, pos, image, n);
+        if (err != ESP_OK) {
+            ocs_loge(log_tag, "esp_partition_write(): offset=%u err=%s",
+                     static_cast<unsigned>(pos), esp_err_to_name(err));
+
+            return status::StatusCode::Error;
+        }
+
+        pos += n;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::read_image_(const Record& record,
+                                              size_t offset,
+                                              uint8_t* buf,
+                                              size_t size) {
+    const size_t n =
+        offset < record.size ? std::min<size_t>(size, record.size - offset) : 0;
+
+    if (n) {
+        OCS_STATUS_RETURN_ON_ERROR(read_(staging_, image_offset_ + offset, buf, n));
+    }
+
+    // The partition is erased after the image end.
+    memset(buf + n, 0xFF, size - n);
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::read_(const esp_partition_t* partition,
+                                        size_t offset,
+                                        void* buf,
+                                        size_t size) {
+    const auto err = esp_partition_read(partition, offset, buf, size);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_partition_read(): partition=%s offset=%u err=%s",
+                 partition->label, static_cast<unsigned>(offset), esp_err_to_name(err));
+
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WebGuiUpdater::fail_() {
+    state_ = OtaSession::State::Failed;
+
+    return status::StatusCode::Error;
+}
+
+} // namespace bonsai
+} // namespace ocs
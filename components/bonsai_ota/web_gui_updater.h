@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_partition.h"
+#include "mbedtls/sha256.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_ota/ota_session.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Update the web GUI partition independently of the firmware.
+//!
+//! @remarks
+//!  The web GUI partition is mounted and served while the firmware is running, so it
+//!  can't be rewritten in place. Instead, the new image is staged at the end of the
+//!  inactive OTA partition, which is unused unless the firmware update is in progress.
+//!  The image is written as it arrives, the interrupted upload can be continued from
+//!  the last written byte.
+//!
+//!  The inactive OTA partition usually holds the previous firmware, used for rollback.
+//!  If the previous firmware ends before the staging area, it's kept intact. Otherwise,
+//!  it's invalidated before the image is written, so the bootloader never boots the
+//!  overwritten firmware.
+//!
+//!  When the whole image is written, its SHA-256 is compared with the expected one and
+//!  with the SHA-256 of the image read back from flash. Only then the commit record is
+//!  written to the last sector of the inactive OTA partition.
+//!
+//!  On the next boot, before the web GUI partition is mounted, apply() copies the
+//!  committed image to the web GUI partition, verifies it and erases the record. The
+//!  partition is rewritten sector by sector, only the sectors which differ from the
+//!  image are erased, so the partition is never erased as a whole. If the copy is
+//!  interrupted, it's repeated on the following boot, skipping the sectors which are
+//!  already copied, so the web GUI is switched either completely or not at all.
+//!
+//!  The image format isn't interpreted, it's written to the partition as is. The image
+//!  can be shorter than the partition, the rest of the partition is erased.
+class WebGuiUpdater : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p buffer_size - size of the buffer to verify and to copy the image, in bytes.
+    explicit WebGuiUpdater(size_t buffer_size);
+
+    //! Release the resources.
+    ~WebGuiUpdater();
+
+    //! Copy the committed image to the web GUI partition.
+    //!
+    //! @notes
+    //!  Should be called before the web GUI partition is mounted.
+    status::StatusCode apply();
+
+    //! Start staging the new image, the previous one is discarded.
+    status::StatusCode begin(const OtaSession::Params& params);
+
+    //! Write the next @p size bytes of the image.
+    status::StatusCode write(const void* data, size_t size);
+
+    //! Verify the written image and commit it to be applied on the next boot.
+    //!
+    //! @notes
+    //!  Should be called when the whole image is written.
+    status::StatusCode finish();
+
+    //! Discard the staged image, e.g. when the firmware update is started.
+    void discard();
+
+    //! Return true if the update was started with @p params.
+    bool matches(const OtaSession::Params& params) const;
+
+    //! Return the update state.
+    OtaSession::State get_state() const;
+
+    //! Return the image size, in bytes.
+    size_t get_size() const;
+
+    //! Return the number of written bytes.
+    size_t get_written() const;
+
+private:
+    struct Record {
+        uint32_t magic;
+        uint32_t size;
+        uint8_t sha256[OtaSession::sha256_size];
+        uint32_t crc;
+    };
+
+    bool locate_();
+    status::StatusCode invalidate_rollback_();
+    bool read_record_(Record& record);
+    void erase_record_();
+
+    status::StatusCode hash_(const esp_partition_t* partition,
+                             size_t offset,
+                             size_t size,
+                             uint8_t* sha256);
+
+    status::StatusCode copy_(const Record& record);
+    status::StatusCode
+    copy_sector_(const Record& record, size_t offset, uint8_t* image, uint8_t* current);
+    status::StatusCode
+    read_image_(const Record& record, size_t offset, uint8_t* buf, size_t size);
+    status::StatusCode
+    read_(const esp_partition_t* partition, size_t offset, void* buf, size_t size);
+
+    status::StatusCode fail_();
+
+    const size_t buffer_size_ { 0 };
+
+    const esp_partition_t* web_gui_ { nullptr };
+    const esp_partition_t* staging_ { nullptr };
+
+    size_t image_offset_ { 0 };
+    size_t record_offset_ { 0 };
+
+    OtaSession::State state_ { OtaSession::State::Idle };
+    OtaSession::Params params_;
+
+    size_t written_ { 0 };
+    size_t erased_ { 0 };
+
+    mbedtls_sha256_context sha256_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <memory>
+
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_http/response_ops.h"
+#include "bonsai_power/power_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+PowerHandler::PowerHandler(PowerManager& manager)
+    : manager_(manager) {
+}
+
+status::StatusCode PowerHandler::handle(httpd_req_t* req) {
+    char query[32];
+
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+        char value[8];
+
+        if (httpd_query_key_value(query, "level", value, sizeof(value)) == ESP_OK) {
+            PowerManager::Level level = PowerManager::Level::None;
+
+            if (!PowerManager::level_from_str(value, level)) {
+                return ResponseOps::send_text(req, HTTPD_400, "invalid level");
+            }
+
+            const auto code = manager_.set_level(level);
+            if (code != status::StatusCode::OK) {
+                return ResponseOps::send_text(req, HTTPD_500, status::code_to_str(code));
+            }
+        }
+    }
+
+    std::unique_ptr<cJSON, decltype(&cJSON_Delete)> json(cJSON_CreateObject(),
+                                                         cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = manager_.format(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return ResponseOps::send_json(req, json.get());
+}
+
+} // namespace bonsai
+} // namespace ocs
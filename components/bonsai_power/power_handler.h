@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_http/ihandler.h"
+#include "bonsai_power/power_manager.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Configure the power save level over HTTP.
+//!
+//! @remarks
+//!  Query parameters:
+//!   - level - "none", "min" or "max", see PowerManager::Level. If omitted, the
+//!     state is returned as is.
+class PowerHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit PowerHandler(PowerManager& manager);
+
+    //! Handle HTTP request.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    PowerManager& manager_;
+};
+
+} // namespace bonsai
+} // namespace ocs
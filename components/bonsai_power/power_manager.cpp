@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "esp_pm.h"
+#include "esp_wifi.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_power/power_manager.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "power_manager";
+
+wifi_ps_type_t level_to_ps(PowerManager::Level level) {
+    switch (level) {
+    case PowerManager::Level::Min:
+        return WIFI_PS_MIN_MODEM;
+
+    case PowerManager::Level::Max:
+        return WIFI_PS_MAX_MODEM;
+
+    default:
+        break;
+    }
+
+    return WIFI_PS_NONE;
+}
+
+} // namespace
+
+const char* PowerManager::level_to_str(Level level) {
+    switch (level) {
+    case Level::None:
+        return "none";
+
+    case Level::Min:
+        return "min";
+
+    case Level::Max:
+        return "max";
+    }
+
+    return "<none>";
+}
+
+bool PowerManager::level_from_str(const char* str, Level& level) {
+    const Level levels[] = { Level::None, Level::Min, Level::Max };
+
+    for (const auto l : levels) {
+        if (strcmp(str, level_to_str(l)) == 0) {
+            level = l;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+PowerManager::PowerManager(storage::IStorage& storage, Params params)
+    : params_(params)
+    , storage_(storage)
+    , level_(params.level) {
+    uint8_t level = 0;
+
+    const auto code = storage_.read(storage_key_, &level, sizeof(level));
+    if (code == status::StatusCode::OK) {
+        if (level <= static_cast<uint8_t>(Level::Max)) {
+            level_ = static_cast<Level>(level);
+        }
+    } else if (code != status::StatusCode::NoData) {
+        ocs_logw(log_tag, "failed to read level: %s", status::code_to_str(code));
+    }
+}
+
+status::StatusCode PowerManager::prepare() {
+    wifi_config_t config;
+    memset(&config, 0, sizeof(config));
+
+    auto err = esp_wifi_get_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_get_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    config.sta.listen_interval = params_.listen_interval;
+
+    err = esp_wifi_set_config(WIFI_IF_STA, &config);
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_set_config(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode PowerManager::start() {
+    MutexLock lock(mu_);
+
+    started_ = true;
+
+    return apply_(level_);
+}
+
+status::StatusCode PowerManager::set_level(Level level) {
+    MutexLock lock(mu_);
+
+    const uint8_t value = static_cast<uint8_t>(level);
+
+    const auto code = storage_.write(storage_key_, &value, sizeof(value));
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    level_ = level;
+
+    if (!started_) {
+        return status::StatusCode::OK;
+    }
+
+    return apply_(level_);
+}
+
+PowerManager::Level PowerManager::get_level() const {
+    MutexLock lock(mu_);
+    return level_;
+}
+
+status::StatusCode PowerManager::format(cJSON* json) {
+    MutexLock lock(mu_);
+
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_string_ref_cs("level", level_to_str(level_))) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_bool_cs("light_sleep", light_sleep_)) {
+        return status::StatusCode::NoMem;
+    }
+
+    if (!formatter.add_number_cs("listen_interval", params_.listen_interval)) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode PowerManager::apply_(Level level) {
+    const auto err = esp_wifi_set_ps(level_to_ps(level));
+    if (err != ESP_OK) {
+        ocs_loge(log_tag, "esp_wifi_set_ps(): %s", esp_err_to_name(err));
+        return status::StatusCode::Error;
+    }
+
+#ifdef CONFIG_PM_ENABLE
+    // WiFi requires the modem sleep to be enabled for the light sleep.
+    const bool light_sleep = params_.light_sleep && level != Level::None;
+
+    esp_pm_config_t config;
+    memset(&config, 0, sizeof(config));
+
+    config.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    config.min_freq_mhz = CONFIG_XTAL_FREQ;
+    config.light_sleep_enable = light_sleep;
+
+    const auto pm_err = esp_pm_configure(&config);
+    if (pm_err != ESP_OK) {
+        ocs_loge(log_tag, "esp_pm_configure(): %s", esp_err_to_name(pm_err));
+        return status::StatusCode::Error;
+    }
+
+    light_sleep_ = light_sleep;
+#endif // CONFIG_PM_ENABLE
+
+    ocs_logi(log_tag, "power save: level=%s light_sleep=%d", level_to_str(level),
+             light_sleep_);
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_status/code.h"
+#include "ocs_storage/istorage.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Manage the WiFi modem sleep and the CPU light sleep.
+//!
+//! @remarks
+//!  - In the modem sleep the radio is turned off between the DTIM beacons. It's
+//!    turned on to receive the buffered inbound packets, e.g. HTTP requests, after
+//!    the beacon, and for each outbound packet, e.g. MQTT publish or UDP beacon.
+//!  - In the light sleep the CPU is paused when all the tasks are blocked, e.g.
+//!    between the task scheduler runs. The light sleep is used only with the modem
+//!    sleep, and requires CONFIG_PM_ENABLE and CONFIG_FREERTOS_USE_TICKLESS_IDLE.
+//!
+//!  The level is persisted in the storage and can be changed at runtime.
+class PowerManager : public fmt::json::IFormatter, public core::NonCopyable<> {
+public:
+    //! Power save level.
+    enum class Level : uint8_t {
+        //! Radio is always on, lowest latency.
+        None,
+
+        //! Radio wakes up for each DTIM beacon.
+        Min,
+
+        //! Radio wakes up for every listen_interval beacons, lowest power.
+        Max,
+    };
+
+    struct Params {
+        //! Level used until the level is configured.
+        Level level { Level::Min };
+
+        //! Number of the beacon intervals between the wake-ups, for Level::Max.
+        uint8_t listen_interval { 0 };
+
+        //! Enable CPU light sleep when the power save is enabled.
+        bool light_sleep { false };
+    };
+
+    //! Return the level name.
+    static const char* level_to_str(Level level);
+
+    //! Parse the level name.
+    static bool level_from_str(const char* str, Level& level);
+
+    //! Initialize.
+    PowerManager(storage::IStorage& storage, Params params);
+
+    //! Configure the listen interval.
+    //!
+    //! @remarks
+    //!  Should be called before the WiFi connection is started.
+    status::StatusCode prepare();
+
+    //! Apply the power save level.
+    //!
+    //! @remarks
+    //!  Should be called after the WiFi is started.
+    status::StatusCode start();
+
+    //! Persist and apply the power save @p level.
+    status::StatusCode set_level(Level level);
+
+    //! Return the current power save level.
+    Level get_level() const;
+
+    //! Format the power management state.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    static constexpr const char* storage_key_ = "level";
+
+    status::StatusCode apply_(Level level);
+
+    const Params params_;
+
+    storage::IStorage& storage_;
+
+    mutable StaticMutex mu_;
+
+    Level level_ { Level::None };
+    bool started_ { false };
+    bool light_sleep_ { false };
+};
+
+} // namespace bonsai
+} // namespace ocs
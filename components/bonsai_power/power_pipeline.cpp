@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_power/power_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+PowerPipeline::PowerPipeline(WriteBehindPipeline& write_behind_pipeline,
+                             http::IRouter& router) {
+#ifdef CONFIG_BONSAI_FIRMWARE_POWER_SAVE_ENABLE
+    PowerManager::Level level = PowerManager::Level::None;
+    configASSERT(PowerManager::level_from_str(
+        CONFIG_BONSAI_FIRMWARE_POWER_SAVE_DEFAULT_LEVEL, level));
+
+    manager_.reset(new (std::nothrow) PowerManager(
+        write_behind_pipeline.make("power"),
+        PowerManager::Params {
+            .level = level,
+            .listen_interval = CONFIG_BONSAI_FIRMWARE_POWER_SAVE_LISTEN_INTERVAL,
+#ifdef CONFIG_BONSAI_FIRMWARE_POWER_SAVE_LIGHT_SLEEP
+            .light_sleep = true,
+#else
+            .light_sleep = false,
+#endif // CONFIG_BONSAI_FIRMWARE_POWER_SAVE_LIGHT_SLEEP
+        }));
+    configASSERT(manager_);
+
+    handler_.reset(new (std::nothrow) PowerHandler(*manager_));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/config/power",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)write_behind_pipeline;
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_POWER_SAVE_ENABLE
+}
+
+status::StatusCode PowerPipeline::prepare() {
+    if (manager_) {
+        return manager_->prepare();
+    }
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode PowerPipeline::start() {
+    if (manager_) {
+        return manager_->start();
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
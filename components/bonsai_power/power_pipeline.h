@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_power/power_handler.h"
+#include "bonsai_power/power_manager.h"
+#include "bonsai_storage/write_behind_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! WiFi modem sleep and CPU light sleep.
+//!
+//! @remarks
+//!  The level is persisted in the "power" storage and configured via
+//!  GET /api/v1/config/power, see PowerHandler.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_POWER_SAVE_ENABLE is disabled, the WiFi and CPU power
+//!  settings are left untouched.
+class PowerPipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    PowerPipeline(WriteBehindPipeline& write_behind_pipeline, http::IRouter& router);
+
+    //! Configure the WiFi before the connection is started.
+    status::StatusCode prepare();
+
+    //! Apply the power save level after the WiFi is started.
+    status::StatusCode start();
+
+private:
+    std::unique_ptr<PowerManager> manager_;
+    std::unique_ptr<PowerHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_replay/recording_adc_store.h"
+
+namespace ocs {
+namespace bonsai {
+
+RecordingAdcStore::Reader::Reader(io::adc::IReader& reader,
+                                  SensorTraceRecorder& recorder,
+                                  io::adc::Channel channel)
+    : reader_(reader)
+    , recorder_(recorder)
+    , channel_(channel) {
+}
+
+io::adc::IReader::Result RecordingAdcStore::Reader::read() {
+    const auto result = reader_.read();
+
+    recorder_.record(static_cast<uint8_t>(channel_), result.value, result.code);
+
+    return result;
+}
+
+RecordingAdcStore::RecordingAdcStore(io::adc::IStore& store,
+                                     SensorTraceRecorder& recorder)
+    : store_(store)
+    , recorder_(recorder) {
+}
+
+io::adc::IReader* RecordingAdcStore::add(io::adc::Channel channel) {
+    io::adc::IReader* reader = store_.add(channel);
+    if (!reader) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Reader> recording_reader(new (std::nothrow)
+                                                 Reader(*reader, recorder_, channel));
+    configASSERT(recording_reader);
+
+    readers_.push_back(std::move(recording_reader));
+
+    return readers_.back().get();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_io/adc/ireader.h"
+#include "ocs_io/adc/istore.h"
+
+#include "bonsai_replay/sensor_trace_recorder.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Record the raw values read from the underlying ADC store.
+class RecordingAdcStore : public io::adc::IStore, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p store to read the ADC channels from.
+    //!  - @p recorder to record the read values.
+    RecordingAdcStore(io::adc::IStore& store, SensorTraceRecorder& recorder);
+
+    //! Return the reader for @p channel which records each read value.
+    io::adc::IReader* add(io::adc::Channel channel) override;
+
+private:
+    class Reader : public io::adc::IReader, public core::NonCopyable<> {
+    public:
+        Reader(io::adc::IReader& reader,
+               SensorTraceRecorder& recorder,
+               io::adc::Channel channel);
+
+        Result read() override;
+
+    private:
+        io::adc::IReader& reader_;
+        SensorTraceRecorder& recorder_;
+
+        const io::adc::Channel channel_;
+    };
+
+    io::adc::IStore& store_;
+    SensorTraceRecorder& recorder_;
+
+    std::vector<std::unique_ptr<Reader>> readers_;
+};
+
+} // namespace bonsai
+} // namespace ocs
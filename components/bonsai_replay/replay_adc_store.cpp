@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "bonsai_replay/replay_adc_store.h"
+
+namespace ocs {
+namespace bonsai {
+
+ReplayAdcStore::Reader::Reader(core::IClock& clock,
+                               const SensorTraceReader& trace,
+                               io::adc::Channel channel)
+    : clock_(clock)
+    , trace_(trace)
+    , channel_(static_cast<uint8_t>(channel)) {
+}
+
+io::adc::IReader::Result ReplayAdcStore::Reader::read() {
+    const auto now = clock_.now();
+
+    // Records are ordered by time within the channel, but not across the channels.
+    for (; pos_ < trace_.get_count(); ++pos_) {
+        const auto record = trace_.get(pos_);
+        if (record.channel != channel_) {
+            continue;
+        }
+
+        if (record.timestamp > now) {
+            break;
+        }
+
+        record_ = record;
+        has_record_ = true;
+    }
+
+    Result result;
+
+    if (!has_record_) {
+        result.code = status::StatusCode::NoData;
+        return result;
+    }
+
+    result.value = record_.value;
+    result.code = record_.code;
+
+    return result;
+}
+
+ReplayAdcStore::ReplayAdcStore(core::IClock& clock, const SensorTraceReader& trace)
+    : clock_(clock)
+    , trace_(trace) {
+}
+
+io::adc::IReader* ReplayAdcStore::add(io::adc::Channel channel) {
+    std::unique_ptr<Reader> reader(new (std::nothrow) Reader(clock_, trace_, channel));
+    if (!reader) {
+        return nullptr;
+    }
+
+    readers_.push_back(std::move(reader));
+
+    return readers_.back().get();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_io/adc/ireader.h"
+#include "ocs_io/adc/istore.h"
+
+#include "bonsai_replay/sensor_trace.h"
+#include "bonsai_replay/sensor_trace_reader.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Read the ADC channels from the recorded sensor trace.
+//!
+//! @remarks
+//!  Each read returns the last recorded value of the channel with the timestamp not
+//!  later than the current time of @p clock. Reads made before the first record of
+//!  the channel fail with status::StatusCode::NoData.
+class ReplayAdcStore : public io::adc::IStore, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p clock to select the record, usually VirtualClock.
+    //!  - @p trace to read the records from.
+    ReplayAdcStore(core::IClock& clock, const SensorTraceReader& trace);
+
+    //! Return the reader replaying @p channel.
+    io::adc::IReader* add(io::adc::Channel channel) override;
+
+private:
+    class Reader : public io::adc::IReader, public core::NonCopyable<> {
+    public:
+        Reader(core::IClock& clock,
+               const SensorTraceReader& trace,
+               io::adc::Channel channel);
+
+        Result read() override;
+
+    private:
+        core::IClock& clock_;
+        const SensorTraceReader& trace_;
+
+        const uint8_t channel_ { 0 };
+
+        size_t pos_ { 0 };
+        bool has_record_ { false };
+        SensorTrace::Record record_;
+    };
+
+    core::IClock& clock_;
+    const SensorTraceReader& trace_;
+
+    std::vector<std::unique_ptr<Reader>> readers_;
+};
+
+} // namespace bonsai
+} // namespace ocs
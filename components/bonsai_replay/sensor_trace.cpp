@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "bonsai_replay/sensor_trace.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char magic[] = { 'B', 'S', 'T', 'R' };
+
+void write_le(uint8_t* buf, uint64_t value, size_t size) {
+    for (size_t n = 0; n < size; ++n) {
+        buf[n] = static_cast<uint8_t>(value >> (n * 8));
+    }
+}
+
+uint64_t read_le(const uint8_t* buf, size_t size) {
+    uint64_t value = 0;
+
+    for (size_t n = 0; n < size; ++n) {
+        value |= static_cast<uint64_t>(buf[n]) << (n * 8);
+    }
+
+    return value;
+}
+
+} // namespace
+
+void SensorTrace::write_header(uint8_t* buf) {
+    memcpy(buf, magic, sizeof(magic));
+    buf[4] = version;
+    buf[5] = record_size;
+    write_le(buf + 6, 0, 2);
+}
+
+bool SensorTrace::check_header(const uint8_t* buf, size_t size) {
+    if (size < header_size) {
+        return false;
+    }
+
+    return memcmp(buf, magic, sizeof(magic)) == 0 && buf[4] == version
+        && buf[5] == record_size;
+}
+
+void SensorTrace::encode(const Record& record, uint8_t* buf) {
+    write_le(buf, static_cast<uint64_t>(record.timestamp), 8);
+    write_le(buf + 8, static_cast<uint32_t>(record.value), 4);
+    write_le(buf + 12, record.count, 2);
+    buf[14] = record.channel;
+    buf[15] = static_cast<uint8_t>(record.code);
+}
+
+SensorTrace::Record SensorTrace::decode(const uint8_t* buf) {
+    Record record;
+
+    record.timestamp = static_cast<core::Time>(read_le(buf, 8));
+    record.value = static_cast<int32_t>(read_le(buf + 8, 4));
+    record.count = static_cast<uint16_t>(read_le(buf + 12, 2));
+    record.channel = buf[14];
+    record.code = static_cast<status::StatusCode>(buf[15]);
+
+    return record;
+}
+
+} // namespace bonsai
+} // namespace ocs
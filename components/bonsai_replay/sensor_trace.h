@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Binary trace of the raw sensor readings.
+//!
+//! @remarks
+//!  The trace is the header followed by the fixed-size records. Records of each
+//!  channel are ordered by time. All integers are little-endian.
+//!
+//!  Header, 8 bytes:
+//!   - magic, "BSTR".
+//!   - format version, u8.
+//!   - record size, u8.
+//!   - reserved, u16.
+//!
+//!  Record, 16 bytes:
+//!   - timestamp of the first sample, in microseconds, i64.
+//!   - mean raw value of the samples, i32.
+//!   - number of samples, u16.
+//!   - ADC channel, u8.
+//!   - read status, see status::StatusCode, u8.
+class SensorTrace : public core::NonCopyable<> {
+public:
+    //! Trace format version.
+    static constexpr uint8_t version = 1;
+
+    //! Size of the trace header, in bytes.
+    static constexpr size_t header_size = 8;
+
+    //! Size of the single record, in bytes.
+    static constexpr size_t record_size = 16;
+
+    //! Raw readings of the single channel made in a short burst.
+    struct Record {
+        //! Time of the first reading.
+        core::Time timestamp { 0 };
+
+        //! Mean raw value of the readings.
+        int32_t value { 0 };
+
+        //! Number of readings.
+        uint16_t count { 0 };
+
+        //! ADC channel.
+        uint8_t channel { 0 };
+
+        //! Result of the readings.
+        status::StatusCode code { status::StatusCode::OK };
+    };
+
+    //! Write the trace header to @p buf.
+    //!
+    //! @notes
+    //!  @p buf should be at least header_size bytes.
+    static void write_header(uint8_t* buf);
+
+    //! Return true if @p buf of @p size bytes starts with the valid trace header.
+    static bool check_header(const uint8_t* buf, size_t size);
+
+    //! Write @p record to @p buf.
+    //!
+    //! @notes
+    //!  @p buf should be at least record_size bytes.
+    static void encode(const Record& record, uint8_t* buf);
+
+    //! Read the record from @p buf.
+    //!
+    //! @notes
+    //!  @p buf should be at least record_size bytes.
+    static Record decode(const uint8_t* buf);
+};
+
+} // namespace bonsai
+} // namespace ocs
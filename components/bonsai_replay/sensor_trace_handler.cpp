@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_http/http_chunk_writer.h"
+#include "bonsai_replay/sensor_trace_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorTraceHandler::SensorTraceHandler(SensorTraceRecorder& recorder)
+    : recorder_(recorder) {
+}
+
+status::StatusCode SensorTraceHandler::handle(httpd_req_t* req) {
+    if (httpd_resp_set_type(req, "application/octet-stream") != ESP_OK) {
+        return status::StatusCode::Error;
+    }
+
+    HttpChunkWriter writer(req);
+
+    const auto code = recorder_.write(writer);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return writer.finish();
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_http/ihandler.h"
+#include "bonsai_replay/sensor_trace_recorder.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Send the recorded sensor trace, see SensorTrace for the format.
+class SensorTraceHandler : public IHandler, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit SensorTraceHandler(SensorTraceRecorder& recorder);
+
+    //! Send the trace as application/octet-stream.
+    status::StatusCode handle(httpd_req_t* req) override;
+
+private:
+    SensorTraceRecorder& recorder_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_replay/sensor_trace_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE
+// Oversampled readings of the channel are made back-to-back, well within this interval.
+const core::Time burst_interval = core::Duration::millisecond * 100;
+#endif // CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE
+
+} // namespace
+
+SensorTracePipeline::SensorTracePipeline(core::IClock& clock,
+                                         io::adc::IStore& store,
+                                         http::IRouter& router)
+    : store_(store) {
+#ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE
+    recorder_.reset(new (std::nothrow) SensorTraceRecorder(
+        clock,
+        SensorTraceRecorder::Params {
+            .capacity = CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_CAPACITY,
+            .burst_interval = burst_interval,
+        }));
+    configASSERT(recorder_);
+
+    recording_store_.reset(new (std::nothrow) RecordingAdcStore(store_, *recorder_));
+    configASSERT(recording_store_);
+
+    handler_.reset(new (std::nothrow) SensorTraceHandler(*recorder_));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/sensor_trace",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+#else
+    (void)clock;
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE
+}
+
+io::adc::IStore& SensorTracePipeline::get_store() {
+    if (recording_store_) {
+        return *recording_store_;
+    }
+
+    return store_;
+}
+
+} // namespace bonsai
+} // namespace ocs
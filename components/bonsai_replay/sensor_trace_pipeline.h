@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_http/irouter.h"
+#include "ocs_io/adc/istore.h"
+
+#include "bonsai_replay/recording_adc_store.h"
+#include "bonsai_replay/sensor_trace_handler.h"
+#include "bonsai_replay/sensor_trace_recorder.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Record the raw ADC readings of the sensors for the offline replay.
+//!
+//! @remarks
+//!  The trace is available via GET /api/v1/diagnostic/sensor_trace, see SensorTrace
+//!  for the format and SensorTraceReplayer for the replay.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE is disabled, the ADC store is used
+//!  as is and nothing is recorded.
+class SensorTracePipeline : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p clock to timestamp the readings.
+    //!  - @p store to read the ADC channels from.
+    //!  - @p router to register the HTTP endpoint.
+    SensorTracePipeline(core::IClock& clock,
+                        io::adc::IStore& store,
+                        http::IRouter& router);
+
+    //! Return the ADC store the sensors should read from.
+    io::adc::IStore& get_store();
+
+private:
+    io::adc::IStore& store_;
+
+    std::unique_ptr<SensorTraceRecorder> recorder_;
+    std::unique_ptr<RecordingAdcStore> recording_store_;
+    std::unique_ptr<SensorTraceHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
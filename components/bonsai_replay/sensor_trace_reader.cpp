@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_replay/sensor_trace_reader.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorTraceReader::SensorTraceReader(const uint8_t* data, size_t size)
+    : data_(data) {
+    valid_ = SensorTrace::check_header(data, size);
+    if (valid_) {
+        count_ = (size - SensorTrace::header_size) / SensorTrace::record_size;
+    }
+}
+
+bool SensorTraceReader::is_valid() const {
+    return valid_;
+}
+
+size_t SensorTraceReader::get_count() const {
+    return count_;
+}
+
+SensorTrace::Record SensorTraceReader::get(size_t index) const {
+    return SensorTrace::decode(data_ + SensorTrace::header_size
+                               + index * SensorTrace::record_size);
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ocs_core/noncopyable.h"
+
+#include "bonsai_replay/sensor_trace.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Read records of the sensor trace from memory.
+class SensorTraceReader : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p data - trace, as sent by GET /api/v1/diagnostic/sensor_trace.
+    //!  - @p size - size of @p data, in bytes.
+    //!
+    //! @notes
+    //!  @p data should be valid during the reader lifetime. An incomplete trailing
+    //!  record is ignored.
+    SensorTraceReader(const uint8_t* data, size_t size);
+
+    //! Return true if @p data starts with the valid trace header.
+    bool is_valid() const;
+
+    //! Return the number of records.
+    size_t get_count() const;
+
+    //! Return the record at @p index.
+    SensorTrace::Record get(size_t index) const;
+
+private:
+    const uint8_t* data_ { nullptr };
+
+    bool valid_ { false };
+    size_t count_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_replay/sensor_trace_recorder.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorTraceRecorder::SensorTraceRecorder(core::IClock& clock, Params params)
+    : params_(params)
+    , clock_(clock) {
+    configASSERT(params_.capacity);
+
+    records_.reset(new (std::nothrow) SensorTrace::Record[params_.capacity]);
+    configASSERT(records_);
+}
+
+void SensorTraceRecorder::record(uint8_t channel, int value, status::StatusCode code) {
+    const auto now = clock_.now();
+
+    MutexLock lock(mutex_);
+
+    Burst* free_burst = nullptr;
+
+    for (auto& burst : bursts_) {
+        if (!burst.active) {
+            if (!free_burst) {
+                free_burst = &burst;
+            }
+
+            continue;
+        }
+
+        if (burst.record.channel != channel) {
+            continue;
+        }
+
+        if (burst.record.code == code && burst.record.count < UINT16_MAX
+            && now - burst.record.timestamp < params_.burst_interval) {
+            burst.sum += value;
+            ++burst.record.count;
+
+            return;
+        }
+
+        complete_(burst);
+
+        free_burst = &burst;
+        break;
+    }
+
+    if (!free_burst) {
+        // Too many channels are read at the same time, don't merge the reading.
+        SensorTrace::Record record;
+        record.timestamp = now;
+        record.value = value;
+        record.count = 1;
+        record.channel = channel;
+        record.code = code;
+
+        append_(record);
+        return;
+    }
+
+    free_burst->active = true;
+    free_burst->sum = value;
+    free_burst->record.timestamp = now;
+    free_burst->record.count = 1;
+    free_burst->record.channel = channel;
+    free_burst->record.code = code;
+}
+
+unsigned SensorTraceRecorder::get_count() {
+    MutexLock lock(mutex_);
+
+    return std::min<uint32_t>(total_count_, params_.capacity);
+}
+
+unsigned SensorTraceRecorder::get_overwrite_count() {
+    MutexLock lock(mutex_);
+
+    return overwrite_count_;
+}
+
+status::StatusCode SensorTraceRecorder::write(IChunkWriter& writer) {
+    uint32_t pos = 0;
+    uint32_t end = 0;
+
+    {
+        MutexLock lock(mutex_);
+
+        for (auto& burst : bursts_) {
+            if (burst.active) {
+                complete_(burst);
+            }
+        }
+
+        end = total_count_;
+        pos = end - std::min<uint32_t>(end, params_.capacity);
+    }
+
+    uint8_t buf[SensorTrace::record_size * batch_size_];
+
+    SensorTrace::write_header(buf);
+
+    auto code =
+        writer.write(reinterpret_cast<const char*>(buf), SensorTrace::header_size);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    while (pos < end) {
+        size_t size = 0;
+
+        {
+            MutexLock lock(mutex_);
+
+            pos = std::max(pos, total_count_ - std::min(total_count_, params_.capacity));
+
+            for (; pos < end && size < sizeof(buf); ++pos) {
+                SensorTrace::encode(records_[pos % params_.capacity], buf + size);
+                size += SensorTrace::record_size;
+            }
+        }
+
+        if (!size) {
+            break;
+        }
+
+        code = writer.write(reinterpret_cast<const char*>(buf), size);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+void SensorTraceRecorder::complete_(Burst& burst) {
+    const int64_t count = burst.record.count;
+
+    burst.record.value = (burst.sum + (burst.sum >= 0 ? count : -count) / 2) / count;
+    burst.active = false;
+
+    append_(burst.record);
+}
+
+void SensorTraceRecorder::append_(const SensorTrace::Record& record) {
+    if (total_count_ >= params_.capacity) {
+        ++overwrite_count_;
+    }
+
+    records_[total_count_ % params_.capacity] = record;
+    ++total_count_;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_http/ichunk_writer.h"
+#include "bonsai_replay/sensor_trace.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Record the raw sensor readings into the fixed-size ring.
+//!
+//! @remarks
+//!  Sensors oversample the ADC, so the readings of the same channel made within
+//!  the burst interval are merged into a single record with their mean value. The
+//!  oldest records are overwritten when the ring is full.
+class SensorTraceRecorder : public core::NonCopyable<> {
+public:
+    //! Maximum number of channels with the incomplete bursts.
+    static constexpr unsigned max_burst_count = 8;
+
+    struct Params {
+        //! Maximum number of records.
+        unsigned capacity { 0 };
+
+        //! Readings of the channel made within this interval form a single record.
+        core::Time burst_interval { 0 };
+    };
+
+    //! Initialize.
+    SensorTraceRecorder(core::IClock& clock, Params params);
+
+    //! Record the reading of @p channel.
+    void record(uint8_t channel, int value, status::StatusCode code);
+
+    //! Return the number of records in the ring.
+    unsigned get_count();
+
+    //! Return the number of overwritten records.
+    unsigned get_overwrite_count();
+
+    //! Write the trace to @p writer.
+    //!
+    //! @remarks
+    //!  The incomplete bursts are recorded first. The ring is locked only while the
+    //!  single batch of records is copied, records overwritten during the write are
+    //!  skipped.
+    status::StatusCode write(IChunkWriter& writer);
+
+private:
+    struct Burst {
+        bool active { false };
+        SensorTrace::Record record;
+        int64_t sum { 0 };
+    };
+
+    static constexpr unsigned batch_size_ = 16;
+
+    void complete_(Burst& burst);
+    void append_(const SensorTrace::Record& record);
+
+    const Params params_;
+
+    core::IClock& clock_;
+
+    StaticMutex mutex_;
+
+    std::unique_ptr<SensorTrace::Record[]> records_;
+    uint32_t total_count_ { 0 };
+    uint32_t overwrite_count_ { 0 };
+
+    Burst bursts_[max_burst_count];
+};
+
+} // namespace bonsai
+} // namespace ocs
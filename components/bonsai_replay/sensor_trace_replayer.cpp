@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+
+#include "bonsai_replay/sensor_trace_replayer.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorTraceReplayer::SensorTraceReplayer(VirtualClock& clock,
+                                         const SensorTraceReader& trace)
+    : clock_(clock)
+    , trace_(trace) {
+}
+
+void SensorTraceReplayer::add(scheduler::ITask& task, core::Time interval) {
+    entries_.push_back(Entry {
+        .task = &task,
+        .interval = interval,
+        .deadline = 0,
+    });
+}
+
+SensorTraceReplayer::Stats SensorTraceReplayer::run() {
+    Stats stats;
+
+    if (!trace_.get_count() || entries_.empty()) {
+        return stats;
+    }
+
+    core::Time begin = trace_.get(0).timestamp;
+    core::Time end = begin;
+
+    for (size_t n = 1; n < trace_.get_count(); ++n) {
+        const auto timestamp = trace_.get(n).timestamp;
+
+        begin = std::min(begin, timestamp);
+        end = std::max(end, timestamp);
+    }
+
+    for (auto& entry : entries_) {
+        if (entry.interval <= 0) {
+            return stats;
+        }
+
+        entry.deadline = begin;
+    }
+
+    while (true) {
+        auto entry = std::min_element(entries_.begin(), entries_.end(),
+                                      [](const Entry& lhs, const Entry& rhs) {
+                                          return lhs.deadline < rhs.deadline;
+                                      });
+        if (entry->deadline > end) {
+            break;
+        }
+
+        clock_.set(entry->deadline);
+
+        if (entry->task->run() != status::StatusCode::OK) {
+            ++stats.error_count;
+        }
+
+        ++stats.run_count;
+        entry->deadline += entry->interval;
+    }
+
+    stats.duration = end - begin;
+
+    return stats;
+}
+
+} // namespace bonsai
+} // namespace ocs
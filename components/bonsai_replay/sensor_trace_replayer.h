@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+
+#include "bonsai_replay/sensor_trace_reader.h"
+#include "bonsai_replay/virtual_clock.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Replay the sensor trace through the sensor tasks as fast as possible.
+//!
+//! @remarks
+//!  The sensors should be built with @p clock and ReplayAdcStore over the same
+//!  trace, so the whole sensor logic, including the soil status FSM, sees the
+//!  recorded readings at the recorded times.
+class SensorTraceReplayer : public core::NonCopyable<> {
+public:
+    //! Replay statistics.
+    struct Stats {
+        //! Number of task runs.
+        unsigned run_count { 0 };
+
+        //! Number of task runs which returned an error.
+        unsigned error_count { 0 };
+
+        //! Virtual time covered by the trace.
+        core::Time duration { 0 };
+    };
+
+    //! Initialize.
+    SensorTraceReplayer(VirtualClock& clock, const SensorTraceReader& trace);
+
+    //! Run @p task every @p interval of the virtual time.
+    void add(scheduler::ITask& task, core::Time interval);
+
+    //! Replay the trace from the first to the last record.
+    //!
+    //! @remarks
+    //!  Tasks are run in the order of their deadlines, the clock is set to the
+    //!  deadline before the task is run.
+    Stats run();
+
+private:
+    struct Entry {
+        scheduler::ITask* task { nullptr };
+        core::Time interval { 0 };
+        core::Time deadline { 0 };
+    };
+
+    VirtualClock& clock_;
+    const SensorTraceReader& trace_;
+
+    std::vector<Entry> entries_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_replay/virtual_clock.h"
+
+namespace ocs {
+namespace bonsai {
+
+core::Time VirtualClock::now() {
+    return now_;
+}
+
+void VirtualClock::set(core::Time time) {
+    now_ = time;
+}
+
+void VirtualClock::advance(core::Time duration) {
+    now_ += duration;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Clock which is moved explicitly, to run the time-dependent logic faster than
+//! the real time.
+class VirtualClock : public core::IClock, public core::NonCopyable<> {
+public:
+    //! Return the current virtual time.
+    core::Time now() override;
+
+    //! Set the current virtual time to @p time.
+    void set(core::Time time);
+
+    //! Move the current virtual time forward by @p duration.
+    void advance(core::Time duration);
+
+private:
+    core::Time now_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
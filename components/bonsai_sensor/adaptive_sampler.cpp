@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+
+namespace ocs {
+namespace bonsai {
+
+core::Time AdaptiveSampler::get_max_interval(core::Time interval) {
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    return std::max(interval,
+                    core::Duration::second
+                        * CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_MAX_INTERVAL);
+#else
+    return interval;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+}
+
+AdaptiveSampler::AdaptiveSampler(core::IClock& clock, ISignal& signal, Params params)
+    : params_(params)
+    , clock_(clock)
+    , signal_(signal) {
+    configASSERT(params_.min_interval > 0);
+    configASSERT(params_.max_interval >= params_.min_interval);
+
+    interval_ = params_.min_interval;
+}
+
+core::Time AdaptiveSampler::get_interval() const {
+    return interval_;
+}
+
+bool AdaptiveSampler::is_due() {
+    if (last_read_ < 0) {
+        return true;
+    }
+
+    return clock_.now() - last_read_ >= interval_ - params_.min_interval / 2;
+}
+
+void AdaptiveSampler::handle_read(status::StatusCode code) {
+    last_read_ = clock_.now();
+
+    if (code != status::StatusCode::OK) {
+        interval_ = params_.min_interval;
+        return;
+    }
+
+    if (signal_.changed(last_read_)) {
+        interval_ = params_.min_interval;
+    } else {
+        interval_ = std::min(interval_ * 2, params_.max_interval);
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
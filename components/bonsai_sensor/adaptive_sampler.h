@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_sensor/iread_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Read the sensor more often when the signal changes, and less often when it's stable.
+//!
+//! @remarks
+//!  The sensor read task is run with the current effective interval by the sampling
+//!  scheduler, and the sampler also decides whether the reading is due, see
+//!  SensorTaskScheduler. Each time the signal changes significantly, the interval drops
+//!  to the minimum. Each time the signal is stable, the interval is doubled, until it
+//!  reaches the maximum.
+class AdaptiveSampler : public IReadHandler, public core::NonCopyable<> {
+public:
+    //! Signal produced by the sensor task.
+    class ISignal {
+    public:
+        //! Destroy.
+        virtual ~ISignal() = default;
+
+        //! Return true if the signal has changed significantly since the last call.
+        //!
+        //! @params
+        //!  - @p now - time of the sensor reading.
+        virtual bool changed(core::Time now) = 0;
+    };
+
+    struct Params {
+        //! Minimum interval between two sensor readings.
+        core::Time min_interval { 0 };
+
+        //! Maximum interval between two sensor readings.
+        core::Time max_interval { 0 };
+    };
+
+    //! Return the maximum read interval for the sensor read every @p interval.
+    static core::Time get_max_interval(core::Time interval);
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p clock to measure the time since the last reading.
+    //!  - @p signal to check whether the sensor data has changed.
+    AdaptiveSampler(core::IClock& clock, ISignal& signal, Params params);
+
+    //! Return the current effective read interval.
+    core::Time get_interval() const;
+
+    //! Return true if the sensor should be read now.
+    //!
+    //! @remarks
+    //!  The sensor task may be run slightly before the minimum interval has elapsed,
+    //!  so the reading is considered due half of the minimum interval before the
+    //!  deadline.
+    bool is_due();
+
+    //! Update the effective interval once the sensor was read.
+    void handle_read(status::StatusCode code) override;
+
+private:
+    const Params params_;
+
+    core::IClock& clock_;
+    ISignal& signal_;
+
+    core::Time last_read_ { -1 };
+    std::atomic<core::Time> interval_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdio>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_sensor/adaptive_sampler_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+AdaptiveSamplerFormatter::AdaptiveSamplerFormatter(AdaptiveSampler& sampler,
+                                                   const char* id)
+    : sampler_(sampler) {
+    const int ret = snprintf(key_, sizeof(key_), "%s_read_interval", id);
+    configASSERT(ret > 0 && static_cast<unsigned>(ret) < sizeof(key_));
+}
+
+status::StatusCode AdaptiveSamplerFormatter::format(cJSON* json) {
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    if (!formatter.add_number_cs(key_,
+                                 sampler_.get_interval() / core::Duration::second)) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
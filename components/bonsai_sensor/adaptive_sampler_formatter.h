@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the effective read interval of the sensor, in seconds.
+class AdaptiveSamplerFormatter : public fmt::json::IFormatter,
+                                 public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p sampler to read the effective interval from.
+    //!  - @p id - sensor identifier, used as a prefix for the JSON key.
+    AdaptiveSamplerFormatter(AdaptiveSampler& sampler, const char* id);
+
+    //! Format the read interval into @p json.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    static constexpr unsigned max_key_size_ = 32;
+
+    AdaptiveSampler& sampler_;
+
+    char key_[max_key_size_];
+};
+
+} // namespace bonsai
+} // namespace ocs
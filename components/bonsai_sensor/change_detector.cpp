@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cmath>
+
+#include "bonsai_sensor/change_detector.h"
+
+namespace ocs {
+namespace bonsai {
+
+ChangeDetector::ChangeDetector(float threshold, core::Time window)
+    : threshold_(threshold)
+    , window_(window) {
+}
+
+bool ChangeDetector::update(float value, core::Time now) {
+    const bool changed = !has_reference_ || std::fabs(value - reference_) >= threshold_
+        || rate_exceeded_(value, now);
+
+    last_value_ = value;
+    last_time_ = now;
+
+    if (changed) {
+        has_reference_ = true;
+        reference_ = value;
+    }
+
+    return changed;
+}
+
+bool ChangeDetector::rate_exceeded_(float value, core::Time now) const {
+    if (!window_ || now <= last_time_) {
+        return false;
+    }
+
+    // |dv / dt| * window >= threshold, without the division.
+    return static_cast<double>(std::fabs(value - last_value_)) * window_
+        >= static_cast<double>(threshold_) * (now - last_time_);
+}
+
+} // namespace bonsai
+} // namespace ocs
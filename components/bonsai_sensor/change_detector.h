@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Detect a significant change of the value.
+//!
+//! @remarks
+//!  The change is significant if either:
+//!   - the value differs from the reference value by the threshold, so a slow drift
+//!     is detected as soon as the accumulated change reaches the threshold;
+//!   - the value changes since the previous one at the rate of at least the threshold
+//!     per the rate window, so a fast change is detected before it reaches the
+//!     threshold.
+class ChangeDetector : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p threshold - minimum absolute change of the value to be considered
+    //!    significant.
+    //!  - @p window - time during which the value should change by @p threshold to
+    //!    be considered changing fast, 0 to disable the rate-of-change check.
+    ChangeDetector(float threshold, core::Time window);
+
+    //! Return true if @p value measured at @p now has changed significantly.
+    //!
+    //! @remarks
+    //!  The first value is always considered significant.
+    bool update(float value, core::Time now);
+
+private:
+    bool rate_exceeded_(float value, core::Time now) const;
+
+    const float threshold_ { 0 };
+    const core::Time window_ { 0 };
+
+    bool has_reference_ { false };
+    float reference_ { 0 };
+
+    float last_value_ { 0 };
+    core::Time last_time_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
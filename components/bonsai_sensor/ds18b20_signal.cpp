@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_sensor/ds18b20_signal.h"
+
+namespace ocs {
+namespace bonsai {
+
+DS18B20Signal::DS18B20Signal(sensor::ds18b20::Sensor& sensor,
+                             float threshold,
+                             core::Time window)
+    : sensor_(sensor)
+    , temperature_(threshold, window) {
+}
+
+bool DS18B20Signal::changed(core::Time now) {
+    return temperature_.update(sensor_.get_data().temperature, now);
+}
+
+} // namespace bonsai
+} // namespace ocs
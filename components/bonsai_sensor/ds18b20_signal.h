@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_sensor/ds18b20/sensor.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/change_detector.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Temperature changes of the DS18B20 sensor.
+class DS18B20Signal : public AdaptiveSampler::ISignal, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p sensor to read the data from.
+    //!  - @p threshold - significant temperature change, in degrees Celsius.
+    //!  - @p window - rate-of-change window, see ChangeDetector.
+    DS18B20Signal(sensor::ds18b20::Sensor& sensor, float threshold, core::Time window);
+
+    //! Return true if the temperature has changed.
+    bool changed(core::Time now) override;
+
+private:
+    sensor::ds18b20::Sensor& sensor_;
+
+    ChangeDetector temperature_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Handle the sensor reading.
+class IReadHandler {
+public:
+    //! Destroy.
+    virtual ~IReadHandler() = default;
+
+    //! Handle the sensor reading.
+    //!
+    //! @params
+    //!  - @p code - result of the sensor read, the sensor data is updated only if
+    //!    it's status::StatusCode::OK.
+    //!
+    //! @notes
+    //!  Called from the sensor read task, right after the sensor is read.
+    virtual void handle_read(status::StatusCode code) = 0;
+};
+
+} // namespace bonsai
+} // namespace ocs
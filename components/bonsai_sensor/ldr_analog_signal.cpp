@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_sensor/ldr_analog_signal.h"
+
+namespace ocs {
+namespace bonsai {
+
+LdrAnalogSignal::LdrAnalogSignal(sensor::ldr::AnalogSensor& sensor,
+                                 float threshold,
+                                 core::Time window)
+    : sensor_(sensor)
+    , lightness_(threshold, window) {
+}
+
+bool LdrAnalogSignal::changed(core::Time now) {
+    return lightness_.update(sensor_.get_data().lightness, now);
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/tracer.h"
+#include "bonsai_sensor/sampling_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "sampling_scheduler";
+
+} // namespace
+
+SamplingScheduler::SamplingScheduler(core::IClock& clock, Params params)
+    : params_(params)
+    , clock_(clock) {
+    configASSERT(params_.stack_size);
+}
+
+SamplingScheduler::~SamplingScheduler() {
+    if (handle_) {
+        vTaskDelete(handle_);
+    }
+}
+
+status::StatusCode
+SamplingScheduler::add(scheduler::ITask& task, const char* id, core::Time interval) {
+    configASSERT(!handle_);
+
+    if (interval <= 0) {
+        return status::StatusCode::InvalidArg;
+    }
+
+    tasks_.push_back(Task {
+        .task = &task,
+        .id = id,
+        .interval = interval,
+    });
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode
+SamplingScheduler::add(scheduler::ITask& task, const char* id, IInterval& interval) {
+    configASSERT(!handle_);
+
+    tasks_.push_back(Task {
+        .task = &task,
+        .id = id,
+        .provider = &interval,
+    });
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode SamplingScheduler::start() {
+    configASSERT(!handle_);
+
+    if (tasks_.empty()) {
+        return status::StatusCode::OK;
+    }
+
+    if (xTaskCreate(run_, "sampling", params_.stack_size, this, params_.priority,
+                    &handle_)
+        != pdPASS) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+void SamplingScheduler::run_(void* arg) {
+    SamplingScheduler& self = *static_cast<SamplingScheduler*>(arg);
+
+    const core::Time now = self.clock_.now();
+
+    for (auto& task : self.tasks_) {
+        task.deadline = now;
+    }
+
+    while (true) {
+        const core::Time delay = self.run_due_() - self.clock_.now();
+        if (delay <= 0) {
+            continue;
+        }
+
+        // Round up, so the task isn't woken before the deadline.
+        const TickType_t ticks = pdMS_TO_TICKS(
+            (delay + core::Duration::millisecond - 1) / core::Duration::millisecond);
+
+        vTaskDelay(ticks ? ticks : 1);
+    }
+}
+
+core::Time SamplingScheduler::run_due_() {
+    core::Time next = INT64_MAX;
+
+    for (auto& task : tasks_) {
+        if (clock_.now() >= task.deadline) {
+            TraceScope trace_scope("task", task.id);
+
+            const auto code = task.task->run();
+            if (code != status::StatusCode::OK) {
+                ocs_logw(log_tag, "task failed: id=%s code=%s", task.id,
+                         status::code_to_str(code));
+            }
+
+            core::Time interval =
+                task.provider ? task.provider->get_interval() : task.interval;
+            if (interval <= 0) {
+                interval = core::Duration::second;
+            }
+
+            task.deadline = clock_.now() + interval;
+        }
+
+        next = std::min(next, task.deadline);
+    }
+
+    return next;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_scheduler/itask_scheduler.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Run the tasks of the adaptively sampled sensors in the dedicated FreeRTOS task.
+//!
+//! @remarks
+//!  The interval of each task can change after each run, e.g. it's chosen by the
+//!  AdaptiveSampler. The FreeRTOS task sleeps until the earliest deadline, so a stable
+//!  sensor doesn't wake the CPU each minimum read interval. All the tasks are run one
+//!  after another, so the tasks of the same sensor pipeline never race.
+class SamplingScheduler : public scheduler::ITaskScheduler, public core::NonCopyable<> {
+public:
+    //! Interval which can change after each task run.
+    class IInterval {
+    public:
+        //! Destroy.
+        virtual ~IInterval() = default;
+
+        //! Return the interval until the next run.
+        virtual core::Time get_interval() = 0;
+    };
+
+    struct Params {
+        //! FreeRTOS task stack size, in bytes.
+        unsigned stack_size { 0 };
+
+        //! FreeRTOS task priority.
+        UBaseType_t priority { 0 };
+    };
+
+    //! Initialize.
+    SamplingScheduler(core::IClock& clock, Params params);
+
+    //! Delete the FreeRTOS task.
+    ~SamplingScheduler();
+
+    //! Run @p task every @p interval.
+    //!
+    //! @notes
+    //!  Should be called before start().
+    status::StatusCode
+    add(scheduler::ITask& task, const char* id, core::Time interval) override;
+
+    //! Run @p task with the interval returned by @p interval after each run.
+    //!
+    //! @notes
+    //!  Should be called before start().
+    status::StatusCode add(scheduler::ITask& task, const char* id, IInterval& interval);
+
+    //! Start the FreeRTOS task.
+    //!
+    //! @notes
+    //!  Can be called only once. Does nothing if no tasks were added.
+    status::StatusCode start();
+
+private:
+    struct Task {
+        scheduler::ITask* task { nullptr };
+        const char* id { nullptr };
+        core::Time interval { 0 };
+        IInterval* provider { nullptr };
+        core::Time deadline { 0 };
+    };
+
+    static void run_(void* arg);
+
+    core::Time run_due_();
+
+    const Params params_;
+
+    core::IClock& clock_;
+
+    std::vector<Task> tasks_;
+
+    TaskHandle_t handle_ { nullptr };
+};
+
+} // namespace bonsai
+} // namespace ocs
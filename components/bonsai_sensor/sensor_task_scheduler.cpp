@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_core/alloc_tracker.h"
+#include "bonsai_core/boot_profiler.h"
+#include "bonsai_core/tracer.h"
+#include "bonsai_sensor/sensor_task_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+SensorTaskScheduler::ReadTask::ReadTask(SensorTaskScheduler& scheduler,
+                                        scheduler::ITask& task)
+    : scheduler_(scheduler)
+    , task_(task) {
+}
+
+status::StatusCode SensorTaskScheduler::ReadTask::run() {
+    return scheduler_.read_(task_);
+}
+
+core::Time SensorTaskScheduler::ReadTask::get_interval() {
+    if (scheduler_.sampler_) {
+        return scheduler_.sampler_->get_interval();
+    }
+
+    return scheduler_.params_.read_interval;
+}
+
+SensorTaskScheduler::SensorTaskScheduler(scheduler::ITaskScheduler& task_scheduler,
+                                         Params params)
+    : params_(params)
+    , task_scheduler_(task_scheduler) {
+    configASSERT(params_.id);
+    configASSERT(params_.read_task_id);
+    configASSERT(params_.read_interval > 0);
+}
+
+void SensorTaskScheduler::set_sampler(AdaptiveSampler& sampler) {
+    configASSERT(!sampler_);
+
+    // The sampler is useless if the read task id doesn't match the sensor pipeline.
+    configASSERT(read_task_);
+
+    sampler_ = &sampler;
+    handlers_.push_back(sampler_);
+}
+
+void SensorTaskScheduler::add_handler(IReadHandler& handler) {
+    // The handlers are notified only by the read task.
+    configASSERT(read_task_);
+
+    handlers_.push_back(&handler);
+}
+
+status::StatusCode
+SensorTaskScheduler::add(scheduler::ITask& task, const char* id, core::Time interval) {
+    if (strcmp(id, params_.read_task_id) != 0) {
+        if (params_.sampling_scheduler) {
+            return params_.sampling_scheduler->add(task, id, interval);
+        }
+
+        if (params_.state_scheduler) {
+            return params_.state_scheduler->add(task, id, interval);
+        }
+
+        return task_scheduler_.add(task, id, interval);
+    }
+
+    configASSERT(!read_task_);
+
+    std::unique_ptr<ReadTask> read_task(new (std::nothrow) ReadTask(*this, task));
+    if (!read_task) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = params_.sampling_scheduler
+        ? params_.sampling_scheduler->add(*read_task, id, *read_task)
+        : task_scheduler_.add(*read_task, id, interval);
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    read_task_ = std::move(read_task);
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode SensorTaskScheduler::read_(scheduler::ITask& task) {
+    if (sampler_ && !sampler_->is_due()) {
+        return status::StatusCode::OK;
+    }
+
+    AllocScope alloc_scope(AllocDomain::Sensor);
+    TraceScope trace_scope("sensor", params_.id);
+
+    const auto code = task.run();
+
+    for (auto& handler : handlers_) {
+        handler->handle_read(code);
+    }
+
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    BootProfiler::mark_once("first_sample");
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
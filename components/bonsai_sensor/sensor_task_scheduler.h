@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_scheduler/itask_scheduler.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/iread_handler.h"
+#include "bonsai_sensor/sampling_scheduler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Register the tasks of a single sensor pipeline in the underlying scheduler.
+//!
+//! @remarks
+//!  The sensor pipeline is created with this scheduler instead of the system one. The
+//!  task registered with the read task id is the sensor read: each read is traced,
+//!  and if the sampler is set, the reads which aren't due are skipped. After each
+//!  read, the registered handlers are notified, so the sensor data consumers are
+//!  driven by the actual readings instead of polling the sensor. Other tasks, e.g.
+//!  the FSM state saving, are registered as is, in the state scheduler if it's set.
+//!
+//!  If the sampling scheduler is set, the read task is run by it, with the interval
+//!  chosen by the sampler, so the CPU isn't woken each read interval while the signal
+//!  is stable. The other tasks are run by the sampling scheduler as well, so they
+//!  never race with the reads.
+class SensorTaskScheduler : public scheduler::ITaskScheduler, public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Sensor identifier, should be valid during the scheduler lifetime.
+        const char* id { nullptr };
+
+        //! Identifier with which the sensor pipeline registers its read task, should be
+        //! valid during the scheduler lifetime.
+        const char* read_task_id { nullptr };
+
+        //! Interval with which the sensor pipeline reads the sensor.
+        core::Time read_interval { 0 };
+
+        //! Scheduler for the other tasks, e.g. the FSM state saving. If not set, the
+        //! underlying scheduler is used.
+        scheduler::ITaskScheduler* state_scheduler { nullptr };
+
+        //! Scheduler to run the reads with the interval chosen by the sampler. If not
+        //! set, the reads are run by the underlying scheduler each read interval.
+        SamplingScheduler* sampling_scheduler { nullptr };
+    };
+
+    //! Initialize.
+    SensorTaskScheduler(scheduler::ITaskScheduler& task_scheduler, Params params);
+
+    //! Skip the sensor reads which aren't due according to @p sampler, and run them with
+    //! the sampler interval if the sampling scheduler is set.
+    //!
+    //! @notes
+    //!  Should be called after the read task is registered, and before the task
+    //!  scheduler is started.
+    void set_sampler(AdaptiveSampler& sampler);
+
+    //! Notify @p handler after each sensor read.
+    //!
+    //! @notes
+    //!  Should be called after the read task is registered, and before the task
+    //!  scheduler is started.
+    void add_handler(IReadHandler& handler);
+
+    //! Register @p task in the underlying scheduler.
+    status::StatusCode
+    add(scheduler::ITask& task, const char* id, core::Time interval) override;
+
+private:
+    class ReadTask : public scheduler::ITask,
+                     public SamplingScheduler::IInterval,
+                     public core::NonCopyable<> {
+    public:
+        ReadTask(SensorTaskScheduler& scheduler, scheduler::ITask& task);
+
+        status::StatusCode run() override;
+        core::Time get_interval() override;
+
+    private:
+        SensorTaskScheduler& scheduler_;
+        scheduler::ITask& task_;
+    };
+
+    status::StatusCode read_(scheduler::ITask& task);
+
+    const Params params_;
+
+    scheduler::ITaskScheduler& task_scheduler_;
+    AdaptiveSampler* sampler_ { nullptr };
+    std::vector<IReadHandler*> handlers_;
+
+    std::unique_ptr<ReadTask> read_task_;
+};
+
+} // namespace bonsai
+} // namespace ocs
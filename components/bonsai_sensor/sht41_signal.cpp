@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_sensor/sht41_signal.h"
+
+namespace ocs {
+namespace bonsai {
+
+SHT41Signal::SHT41Signal(sensor::sht41::Sensor& sensor,
+                         float temperature_threshold,
+                         float humidity_threshold,
+                         core::Time window)
+    : sensor_(sensor)
+    , temperature_(temperature_threshold, window)
+    , humidity_(humidity_threshold, window) {
+}
+
+bool SHT41Signal::changed(core::Time now) {
+    const auto data = sensor_.get_data();
+
+    const bool temperature_changed = temperature_.update(data.temperature, now);
+    const bool humidity_changed = humidity_.update(data.humidity, now);
+
+    return temperature_changed || humidity_changed;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_sensor/sht41/sensor.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/change_detector.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Temperature and humidity changes of the SHT41 sensor.
+class SHT41Signal : public AdaptiveSampler::ISignal, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p sensor to read the data from.
+    //!  - @p temperature_threshold - significant temperature change, in degrees Celsius.
+    //!  - @p humidity_threshold - significant humidity change, in percents.
+    //!  - @p window - rate-of-change window, see ChangeDetector.
+    SHT41Signal(sensor::sht41::Sensor& sensor,
+                float temperature_threshold,
+                float humidity_threshold,
+                core::Time window);
+
+    //! Return true if either the temperature or the humidity has changed.
+    bool changed(core::Time now) override;
+
+private:
+    sensor::sht41::Sensor& sensor_;
+
+    ChangeDetector temperature_;
+    ChangeDetector humidity_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <memory>
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+#include "ocs_status/macros.h"
+
+#include "bonsai_sensor/snapshot_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "snapshot_formatter";
+
+using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+} // namespace
+
+SnapshotFormatter::SnapshotFormatter(fmt::json::IFormatter& formatter)
+    : formatter_(formatter) {
+    const auto code = update_();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to take initial snapshot: code=%s",
+                 status::code_to_str(code));
+    }
+}
+
+void SnapshotFormatter::handle_read(status::StatusCode code) {
+    if (code != status::StatusCode::OK) {
+        return;
+    }
+
+    code = update_();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to take snapshot: code=%s", status::code_to_str(code));
+    }
+}
+
+status::StatusCode SnapshotFormatter::format(cJSON* json) {
+    MutexLock lock(read_mu_);
+
+    Data& data = last_;
+    data_.read(data);
+
+    for (unsigned n = 0; n < data.count; ++n) {
+        const Field& field = data.fields[n];
+        const char* key = data.text + field.key;
+
+        cJSON* item = nullptr;
+
+        switch (field.type) {
+        case Type::Number:
+            item = cJSON_AddNumberToObject(json, key, field.number);
+            break;
+
+        case Type::Bool:
+            item = cJSON_AddBoolToObject(json, key, field.number != 0);
+            break;
+
+        case Type::String:
+            item = cJSON_AddStringToObject(json, key, data.text + field.str);
+            break;
+
+        case Type::Raw:
+            item = cJSON_AddRawToObject(json, key, data.text + field.str);
+            break;
+        }
+
+        if (!item) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+uint32_t SnapshotFormatter::get_version() const {
+    return data_.get_version();
+}
+
+uint32_t SnapshotFormatter::get_drop_count() const {
+    return drop_count_;
+}
+
+status::StatusCode SnapshotFormatter::update_() {
+    JsonPtr json(cJSON_CreateObject(), cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    OCS_STATUS_RETURN_ON_ERROR(formatter_.format(json.get()));
+
+    next_.count = 0;
+    next_.text_size = 0;
+
+    for (const cJSON* item = json->child; item; item = item->next) {
+        if (add_(next_, item)) {
+            continue;
+        }
+
+        if (!drop_count_++) {
+            ocs_loge(log_tag,
+                     "field doesn't fit into snapshot, dropped: field=%s fields=%u "
+                     "text=%u",
+                     item->string ? item->string : "<none>", next_.count,
+                     static_cast<unsigned>(next_.text_size));
+        }
+    }
+
+    data_.write(next_);
+
+    return status::StatusCode::OK;
+}
+
+bool SnapshotFormatter::add_(Data& data, const cJSON* item) {
+    if (data.count == max_field_count) {
+        return false;
+    }
+
+    Field& field = data.fields[data.count];
+
+    const size_t text_size = data.text_size;
+
+    if (!add_text_(data, item->string, field.key)) {
+        return false;
+    }
+
+    switch (item->type & 0xFF) {
+    case cJSON_Number:
+        field.type = Type::Number;
+        field.number = item->valuedouble;
+        break;
+
+    case cJSON_False:
+    case cJSON_True:
+        field.type = Type::Bool;
+        field.number = (item->type & 0xFF) == cJSON_True;
+        break;
+
+    case cJSON_String:
+        field.type = Type::String;
+
+        if (!add_text_(data, item->valuestring, field.str)) {
+            data.text_size = text_size;
+            return false;
+        }
+        break;
+
+    default:
+        field.type = Type::Raw;
+
+        if (!add_raw_(data, item, field.str)) {
+            data.text_size = text_size;
+            return false;
+        }
+        break;
+    }
+
+    ++data.count;
+
+    return true;
+}
+
+bool SnapshotFormatter::add_text_(Data& data, const char* str, uint16_t& offset) {
+    if (!str) {
+        return false;
+    }
+
+    const size_t size = strlen(str) + 1;
+    if (data.text_size + size > max_text_size) {
+        return false;
+    }
+
+    memcpy(data.text + data.text_size, str, size);
+
+    offset = data.text_size;
+    data.text_size += size;
+
+    return true;
+}
+
+bool SnapshotFormatter::add_raw_(Data& data, const cJSON* item, uint16_t& offset) {
+    char* text = data.text + data.text_size;
+
+    if (!cJSON_PrintPreallocated(const_cast<cJSON*>(item), text,
+                                 max_text_size - data.text_size, false)) {
+        return false;
+    }
+
+    offset = data.text_size;
+    data.text_size += strlen(text) + 1;
+
+    return true;
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_status/code.h"
+
+#include "bonsai_core/seqlock.h"
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_sensor/iread_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the sensor data from the snapshot taken right after the sensor read.
+//!
+//! @remarks
+//!  The wrapped formatter is run by the sensor read task, after each successful read,
+//!  and the top-level fields it produces are published through a seqlock. Numbers,
+//!  booleans and strings are stored as is, nested objects, arrays and nulls are
+//!  stored as the serialized JSON. format() is called by the HTTP, MQTT and other
+//!  tasks, it adds the fields of the last snapshot, so these tasks never access the
+//!  sensor while it's being updated, never block the sensor task, and never observe
+//!  a torn data.
+//!
+//!  The fields which don't fit into the snapshot are dropped and counted, the first
+//!  drop is logged as an error: increase max_field_count or max_text_size.
+class SnapshotFormatter : public IReadHandler,
+                          public fmt::json::IFormatter,
+                          public core::NonCopyable<> {
+public:
+    //! Maximum number of fields in the snapshot.
+    static constexpr unsigned max_field_count = 16;
+
+    //! Total size of the field names and string values, in bytes.
+    static constexpr size_t max_text_size = 512;
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p formatter to format the sensor data.
+    //!
+    //! @remarks
+    //!  The initial snapshot is taken during the construction.
+    explicit SnapshotFormatter(fmt::json::IFormatter& formatter);
+
+    //! Take a new snapshot if the sensor was read successfully.
+    void handle_read(status::StatusCode code) override;
+
+    //! Format the last snapshot.
+    status::StatusCode format(cJSON* json) override;
+
+    //! Return the number of taken snapshots.
+    uint32_t get_version() const;
+
+    //! Return the number of fields dropped because the snapshot was full.
+    uint32_t get_drop_count() const;
+
+private:
+    enum class Type : uint8_t {
+        Number,
+        Bool,
+        String,
+        Raw,
+    };
+
+    struct Field {
+        //! Offset of the field name in the text.
+        uint16_t key { 0 };
+
+        //! Offset of the string value or the serialized JSON in the text.
+        uint16_t str { 0 };
+
+        Type type { Type::Number };
+        double number { 0 };
+    };
+
+    struct Data {
+        unsigned count { 0 };
+        Field fields[max_field_count];
+
+        size_t text_size { 0 };
+        char text[max_text_size];
+    };
+
+    status::StatusCode update_();
+
+    bool add_(Data& data, const cJSON* item);
+    bool add_text_(Data& data, const char* str, uint16_t& offset);
+    bool add_raw_(Data& data, const cJSON* item, uint16_t& offset);
+
+    fmt::json::IFormatter& formatter_;
+
+    std::atomic<uint32_t> drop_count_ { 0 };
+
+    // Snapshot being built, used only by the sensor read task.
+    Data next_;
+
+    // Snapshot being formatted, the readers are serialized, so the snapshot isn't
+    // copied to the stack of each reader.
+    StaticMutex read_mu_;
+    Data last_;
+
+    Seqlock<Data> data_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_sensor/soil_analog_signal.h"
+
+namespace ocs {
+namespace bonsai {
+
+SoilAnalogSignal::SoilAnalogSignal(sensor::soil::AnalogSensor& sensor,
+                                   float threshold,
+                                   core::Time window)
+    : sensor_(sensor)
+    , moisture_(threshold, window)
+    , status_(1, 0) {
+}
+
+bool SoilAnalogSignal::changed(core::Time now) {
+    const auto data = sensor_.get_data();
+
+    // Both detectors should be updated, to keep the reference values up to date.
+    const bool moisture_changed = moisture_.update(data.moisture, now);
+    const bool status_changed = status_.update(static_cast<float>(data.curr_status), now);
+
+    return moisture_changed || status_changed;
+}
+
+} // namespace bonsai
+} // namespace ocs
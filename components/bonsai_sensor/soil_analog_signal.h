@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_sensor/soil/analog_sensor.h"
+
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/change_detector.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Soil moisture and soil status changes.
+class SoilAnalogSignal : public AdaptiveSampler::ISignal, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p sensor to read the data from.
+    //!  - @p threshold - significant moisture change, in percents.
+    //!  - @p window - rate-of-change window, see ChangeDetector.
+    SoilAnalogSignal(sensor::soil::AnalogSensor& sensor,
+                     float threshold,
+                     core::Time window);
+
+    //! Return true if either the moisture or the soil status has changed.
+    bool changed(core::Time now) override;
+
+private:
+    sensor::soil::AnalogSensor& sensor_;
+
+    ChangeDetector moisture_;
+    ChangeDetector status_;
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_sensor/soil_analog_snapshot.h"
+
+namespace ocs {
+namespace bonsai {
+
+void SoilAnalogSnapshot::add(sensor::soil::AnalogSensor& sensor) {
+    configASSERT(count_ < max_sensor_count);
+
+    sensors_[count_] = &sensor;
+    ++count_;
+}
+
+SoilAnalogSnapshot::Data SoilAnalogSnapshot::get() const {
+    return data_.read();
+}
+
+void SoilAnalogSnapshot::handle_read(status::StatusCode code) {
+    if (code != status::StatusCode::OK) {
+        return;
+    }
+
+    Data data;
+    data.count = count_;
+
+    for (unsigned n = 0; n < count_; ++n) {
+        data.sensors[n] = sensors_[n]->get_data();
+    }
+
+    data_.write(data);
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_sensor/soil/analog_sensor.h"
+
+#include "bonsai_core/seqlock.h"
+#include "bonsai_sensor/iread_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Consistent snapshot of the data of multiple soil sensors.
+//!
+//! @remarks
+//!  The snapshot is taken right after any of the sensors is read, by the same task
+//!  which updates the sensors, see SensorTaskScheduler, so all sensors are captured
+//!  between the readings. HTTP handlers read the snapshot without blocking the
+//!  scheduler and never observe a torn data.
+class SoilAnalogSnapshot : public IReadHandler, public core::NonCopyable<> {
+public:
+    //! Maximum number of sensors in the snapshot.
+    static constexpr unsigned max_sensor_count = 4;
+
+    struct Data {
+        //! Number of valid entries in @p sensors.
+        unsigned count { 0 };
+
+        //! Sensors data, in the order the sensors were added.
+        sensor::soil::AnalogSensor::Data sensors[max_sensor_count];
+    };
+
+    //! Add @p sensor to the snapshot.
+    //!
+    //! @notes
+    //!  Should be called before the task scheduler is started.
+    void add(sensor::soil::AnalogSensor& sensor);
+
+    //! Return the last snapshot.
+    Data get() const;
+
+    //! Capture the data of all sensors if the sensor was read successfully.
+    void handle_read(status::StatusCode code) override;
+
+private:
+    unsigned count_ { 0 };
+    sensor::soil::AnalogSensor* sensors_[max_sensor_count];
+
+    Seqlock<Data> data_;
+};
+
+} // namespace bonsai
+} // namespace ocs
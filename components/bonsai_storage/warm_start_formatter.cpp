@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_fmt/json/cjson_object_formatter.h"
+
+#include "bonsai_storage/warm_start_formatter.h"
+#include "bonsai_storage/warm_start_store.h"
+
+namespace ocs {
+namespace bonsai {
+
+WarmStartFormatter::WarmStartFormatter(fmt::json::IFormatter& formatter,
+                                       unsigned slot,
+                                       const char* id)
+    : slot_(slot)
+    , id_(id)
+    , formatter_(formatter)
+    , restored_(nullptr, cJSON_Delete) {
+    snprintf(age_key_, sizeof(age_key_), "%s_stale_age", id_);
+
+    const char* data = WarmStartStore::read(slot_, id_, timestamp_);
+    if (data) {
+        restored_.reset(cJSON_Parse(data));
+    }
+}
+
+void WarmStartFormatter::handle_read(status::StatusCode code) {
+    if (code == status::StatusCode::OK) {
+        live_ = true;
+    }
+}
+
+status::StatusCode WarmStartFormatter::format(cJSON* json) {
+    MutexLock lock(mu_);
+
+    if (restoring_()) {
+        return format_restored_(json);
+    }
+
+    return formatter_.format(json);
+}
+
+status::StatusCode WarmStartFormatter::snapshot() {
+    MutexLock lock(mu_);
+
+    if (restoring_()) {
+        return status::StatusCode::OK;
+    }
+
+    JsonPtr json(cJSON_CreateObject(), cJSON_Delete);
+    if (!json) {
+        return status::StatusCode::NoMem;
+    }
+
+    const auto code = formatter_.format(json.get());
+    if (code != status::StatusCode::OK) {
+        return code;
+    }
+
+    return WarmStartStore::write(slot_, id_, json.get(), time(nullptr));
+}
+
+bool WarmStartFormatter::restoring_() {
+    if (!restored_) {
+        return false;
+    }
+
+    if (!live_) {
+        return true;
+    }
+
+    restored_.reset();
+
+    return false;
+}
+
+status::StatusCode WarmStartFormatter::format_restored_(cJSON* json) {
+    const cJSON* item = nullptr;
+
+    cJSON_ArrayForEach(item, restored_.get()) {
+        cJSON* copy = cJSON_Duplicate(item, true);
+        if (!copy) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!cJSON_AddItemToObject(json, item->string, copy)) {
+            cJSON_Delete(copy);
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    fmt::json::CjsonObjectFormatter formatter(json);
+
+    const time_t age = std::max<time_t>(0, time(nullptr) - timestamp_);
+
+    if (!formatter.add_number_cs(age_key_, age)) {
+        return status::StatusCode::NoMem;
+    }
+
+    return status::StatusCode::OK;
+}
+
+} // namespace bonsai
+} // namespace ocs
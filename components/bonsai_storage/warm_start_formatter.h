@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <ctime>
+#include <memory>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_sensor/iread_handler.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Format the telemetry restored from the RTC memory until the sensor is read.
+//!
+//! @remarks
+//!  Until the first successful sensor reading, the snapshot written before the
+//!  reboot is formatted instead of the live data, along with "<id>_stale_age", the
+//!  snapshot age in seconds. Afterwards the live data is formatted as is.
+class WarmStartFormatter : public IReadHandler,
+                           public fmt::json::IFormatter,
+                           public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p formatter to format the live data.
+    //!  - @p slot - RTC memory slot index, see WarmStartStore.
+    //!  - @p id - sensor identifier.
+    WarmStartFormatter(fmt::json::IFormatter& formatter, unsigned slot, const char* id);
+
+    //! Switch to the live data once the sensor was read successfully.
+    void handle_read(status::StatusCode code) override;
+
+    //! Format either the restored snapshot or the live data.
+    status::StatusCode format(cJSON* json) override;
+
+    //! Write the live data to the RTC memory.
+    //!
+    //! @remarks
+    //!  Skipped while the restored snapshot is formatted, the live data isn't
+    //!  available yet.
+    status::StatusCode snapshot();
+
+private:
+    using JsonPtr = std::unique_ptr<cJSON, decltype(&cJSON_Delete)>;
+
+    bool restoring_();
+    status::StatusCode format_restored_(cJSON* json);
+
+    const unsigned slot_ { 0 };
+    const char* id_ { nullptr };
+
+    fmt::json::IFormatter& formatter_;
+
+    // Set by the sensor read task, never blocks it.
+    std::atomic<bool> live_ { false };
+
+    StaticMutex mu_;
+    JsonPtr restored_;
+    time_t timestamp_ { 0 };
+    char age_key_[32];
+};
+
+} // namespace bonsai
+} // namespace ocs
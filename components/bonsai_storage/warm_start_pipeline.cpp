@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_storage/warm_start_pipeline.h"
+#include "bonsai_storage/warm_start_store.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "warm_start_pipeline";
+
+} // namespace
+
+WarmStartPipeline::WarmStartPipeline(scheduler::ITaskScheduler& task_scheduler,
+                                     system::FanoutRebootHandler& reboot_handler) {
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+    const core::Time snapshot_interval =
+        core::Duration::second * CONFIG_BONSAI_FIRMWARE_WARM_START_SNAPSHOT_INTERVAL;
+
+    configASSERT(task_scheduler.add(*this, "warm_start", snapshot_interval)
+                 == status::StatusCode::OK);
+
+    reboot_handler.add(*this);
+#else
+    (void)task_scheduler;
+    (void)reboot_handler;
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+}
+
+fmt::json::IFormatter&
+WarmStartPipeline::wrap(fmt::json::IFormatter& formatter,
+                        const char* id,
+                        std::initializer_list<SensorTaskScheduler*> schedulers) {
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+    configASSERT(strlen(id) <= WarmStartStore::max_id_len);
+
+    if (formatters_.size() == WarmStartStore::get_slot_count()) {
+        ocs_logw(log_tag,
+                 "no free slots for sensor '%s', increase "
+                 "CONFIG_BONSAI_FIRMWARE_WARM_START_SLOT_COUNT",
+                 id);
+
+        return formatter;
+    }
+
+    std::unique_ptr<WarmStartFormatter> warm_start_formatter(
+        new (std::nothrow) WarmStartFormatter(formatter, formatters_.size(), id));
+    configASSERT(warm_start_formatter);
+
+    for (auto scheduler : schedulers) {
+        scheduler->add_handler(*warm_start_formatter);
+    }
+
+    WarmStartFormatter& ret = *warm_start_formatter;
+    formatters_.push_back(std::move(warm_start_formatter));
+
+    return ret;
+#else
+    (void)id;
+    (void)schedulers;
+
+    return formatter;
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+}
+
+status::StatusCode WarmStartPipeline::run() {
+    auto result = status::StatusCode::OK;
+
+    for (auto& formatter : formatters_) {
+        const auto code = formatter->snapshot();
+        if (code != status::StatusCode::OK) {
+            result = code;
+        }
+    }
+
+    return result;
+}
+
+void WarmStartPipeline::handle_reboot() {
+    const auto code = run();
+    if (code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "failed to write telemetry before reboot: %s",
+                 status::code_to_str(code));
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_scheduler/itask_scheduler.h"
+#include "ocs_system/fanout_reboot_handler.h"
+#include "ocs_system/ireboot_handler.h"
+
+#include "bonsai_sensor/sensor_task_scheduler.h"
+#include "bonsai_storage/warm_start_formatter.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Keep the last telemetry of the sensors in the RTC memory across reboots.
+//!
+//! @remarks
+//!  - Telemetry is written to the RTC memory periodically and before reboot.
+//!  - After reboot, the restored telemetry is formatted until the sensor is read
+//!    successfully for the first time, see WarmStartFormatter.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE is disabled, the sensor formatters
+//!  are used as is.
+class WarmStartPipeline : public scheduler::ITask,
+                          public system::IRebootHandler,
+                          public core::NonCopyable<> {
+public:
+    //! Initialize.
+    WarmStartPipeline(scheduler::ITaskScheduler& task_scheduler,
+                      system::FanoutRebootHandler& reboot_handler);
+
+    //! Return the formatter to be added to the telemetry instead of @p formatter.
+    //!
+    //! @params
+    //!  - @p formatter to format the live sensor data.
+    //!  - @p id - sensor identifier, should be valid during the pipeline lifetime.
+    //!  - @p schedulers - schedulers of the sensors formatted by @p formatter, the
+    //!    restored telemetry is formatted until any of the sensors is read.
+    fmt::json::IFormatter& wrap(fmt::json::IFormatter& formatter,
+                                const char* id,
+                                std::initializer_list<SensorTaskScheduler*> schedulers);
+
+    //! Write the telemetry to the RTC memory.
+    status::StatusCode run() override;
+
+    //! Write the telemetry to the RTC memory before reboot.
+    void handle_reboot() override;
+
+private:
+    std::vector<std::unique_ptr<WarmStartFormatter>> formatters_;
+};
+
+} // namespace bonsai
+} // namespace ocs
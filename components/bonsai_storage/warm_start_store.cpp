@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include "esp_attr.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+
+#include "bonsai_storage/warm_start_store.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+// Changing the slot layout should change the magic, to reject the slots written by
+// the previous firmware.
+const uint32_t slot_magic = 0x42535731;
+
+// Should be trivially constructible, the RTC memory must not be initialized at boot.
+struct Slot {
+    uint32_t magic;
+    uint32_t crc;
+    int64_t timestamp;
+    uint32_t size;
+    char id[WarmStartStore::max_id_len + 1];
+    char data[CONFIG_BONSAI_FIRMWARE_WARM_START_SLOT_SIZE];
+};
+
+RTC_NOINIT_ATTR Slot slots[CONFIG_BONSAI_FIRMWARE_WARM_START_SLOT_COUNT];
+
+uint32_t calculate_crc(const Slot& slot) {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(&slot.timestamp);
+    const uint8_t* end = reinterpret_cast<const uint8_t*>(slot.data) + slot.size;
+
+    return esp_rom_crc32_le(0, begin, end - begin);
+}
+
+bool is_valid(const Slot& slot) {
+    if (slot.magic != slot_magic) {
+        return false;
+    }
+
+    if (slot.size == 0 || slot.size > sizeof(slot.data)) {
+        return false;
+    }
+
+    if (slot.crc != calculate_crc(slot)) {
+        return false;
+    }
+
+    return slot.data[slot.size - 1] == '\0' && slot.id[sizeof(slot.id) - 1] == '\0';
+}
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+
+} // namespace
+
+unsigned WarmStartStore::get_slot_count() {
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+    return CONFIG_BONSAI_FIRMWARE_WARM_START_SLOT_COUNT;
+#else
+    return 0;
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+}
+
+const char* WarmStartStore::read(unsigned index, const char* id, time_t& timestamp) {
+    configASSERT(index < get_slot_count());
+
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+    const Slot& slot = slots[index];
+
+    if (!is_valid(slot) || strcmp(slot.id, id) != 0) {
+        return nullptr;
+    }
+
+    timestamp = slot.timestamp;
+
+    return slot.data;
+#else
+    (void)id;
+    (void)timestamp;
+
+    return nullptr;
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+}
+
+status::StatusCode
+WarmStartStore::write(unsigned index, const char* id, cJSON* json, time_t timestamp) {
+    configASSERT(index < get_slot_count());
+    configASSERT(strlen(id) <= max_id_len);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+    Slot& slot = slots[index];
+    slot.magic = 0;
+
+    if (!cJSON_PrintPreallocated(json, slot.data, sizeof(slot.data), false)) {
+        return status::StatusCode::NoMem;
+    }
+
+    memset(slot.id, 0, sizeof(slot.id));
+    strncpy(slot.id, id, max_id_len);
+
+    slot.timestamp = timestamp;
+    slot.size = strlen(slot.data) + 1;
+    slot.crc = calculate_crc(slot);
+    slot.magic = slot_magic;
+
+    return status::StatusCode::OK;
+#else
+    (void)json;
+    (void)timestamp;
+
+    return status::StatusCode::Error;
+#endif // CONFIG_BONSAI_FIRMWARE_WARM_START_ENABLE
+}
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+
+#include "cJSON.h"
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_status/code.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Telemetry snapshots kept in the RTC memory across reboots.
+//!
+//! @remarks
+//!  The RTC memory isn't initialized on software reset and after panic, so the
+//!  snapshots written before the reboot are available after it. Each slot is
+//!  protected with the checksum, to reject the garbage left after the power-on reset.
+//!
+//!  Slots aren't synchronized, each slot should be accessed by a single owner.
+class WarmStartStore : public core::NonCopyable<> {
+public:
+    //! Maximum length of the slot identifier, excluding the null terminator.
+    static constexpr unsigned max_id_len = 15;
+
+    //! Return the number of slots.
+    static unsigned get_slot_count();
+
+    //! Read the snapshot from the slot at @p index.
+    //!
+    //! @params
+    //!  - @p index - slot index.
+    //!  - @p id - identifier the snapshot was written with.
+    //!  - @p timestamp - UNIX time when the snapshot was written.
+    //!
+    //! @return
+    //!  Null-terminated JSON text, or nullptr if the slot is empty, corrupted, or
+    //!  holds a snapshot written with another identifier.
+    static const char* read(unsigned index, const char* id, time_t& timestamp);
+
+    //! Write @p json to the slot at @p index.
+    //!
+    //! @remarks
+    //!  The slot is invalidated first, so the reboot in the middle of the write
+    //!  leaves the slot empty rather than corrupted.
+    static status::StatusCode
+    write(unsigned index, const char* id, cJSON* json, time_t timestamp);
+};
+
+} // namespace bonsai
+} // namespace ocs
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_storage/write_behind_pipeline.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "write_behind_pipeline";
+
+} // namespace
+
+WriteBehindPipeline::WriteBehindPipeline(core::IClock& clock,
+                                         storage::StorageBuilder& storage_builder,
+                                         scheduler::ITaskScheduler& task_scheduler,
+                                         system::FanoutRebootHandler& reboot_handler,
+                                         http::IRouter& router)
+    : clock_(clock)
+    , storage_builder_(storage_builder)
+    , task_scheduler_(task_scheduler) {
+#ifdef CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+    formatter_.reset(new (std::nothrow) fmt::json::FanoutFormatter());
+    configASSERT(formatter_);
+
+    handler_.reset(new (std::nothrow) JsonStreamHandler(
+        *formatter_, CONFIG_BONSAI_FIRMWARE_HTTP_CHUNK_SIZE));
+    configASSERT(handler_);
+
+    router.add(http::IRouter::Method::Get, "/api/v1/diagnostic/storage",
+               [this](httpd_req_t* req) {
+                   return handler_->handle(req);
+               });
+
+    const core::Time commit_interval = core::Duration::second
+        * CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_COMMIT_INTERVAL;
+
+    configASSERT(task_scheduler.add(*this, "write_behind_storage", commit_interval)
+                 == status::StatusCode::OK);
+
+    reboot_handler.add(*this);
+#else
+    (void)reboot_handler;
+    (void)router;
+#endif // CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+}
+
+storage::IStorage& WriteBehindPipeline::make(const char* id) {
+    auto storage = storage_builder_.make(id);
+    configASSERT(storage);
+
+    storage::IStorage& ret = *storage;
+    storages_.push_back(std::move(storage));
+
+#ifdef CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+    std::unique_ptr<WriteBehindStorage> cache(new (std::nothrow) WriteBehindStorage(
+        ret, id,
+        WriteBehindStorage::Params {
+            .max_key_count = CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_MAX_KEY_COUNT,
+            .max_value_size = CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_MAX_VALUE_SIZE,
+        }));
+    configASSERT(cache);
+
+    formatter_->add(*cache);
+
+    WriteBehindStorage& cache_ref = *cache;
+    caches_.push_back(std::move(cache));
+
+    return cache_ref;
+#else
+    return ret;
+#endif // CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+}
+
+status::StatusCode
+WriteBehindPipeline::add(scheduler::ITask& task, const char* id, core::Time interval) {
+#ifdef CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+    tasks_.push_back(Task {
+        .task = &task,
+        .id = id,
+        .interval = interval,
+        .last_run = clock_.now(),
+    });
+
+    return status::StatusCode::OK;
+#else
+    return task_scheduler_.add(task, id, interval);
+#endif // CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE
+}
+
+status::StatusCode WriteBehindPipeline::run() {
+    // Called by the scheduler task and by the reboot task.
+    MutexLock lock(mu_);
+
+    auto result = status::StatusCode::OK;
+
+    for (auto& cache : caches_) {
+        const auto code = cache->flush();
+        if (code != status::StatusCode::OK) {
+            result = code;
+        }
+    }
+
+    const core::Time now = clock_.now();
+
+    for (auto& task : tasks_) {
+        if (now - task.last_run < task.interval) {
+            continue;
+        }
+
+        task.last_run = now;
+
+        const auto code = task.task->run();
+        if (code != status::StatusCode::OK) {
+            ocs_logw(log_tag, "failed to run task: id=%s code=%s", task.id,
+                     status::code_to_str(code));
+
+            result = code;
+        }
+    }
+
+    return result;
+}
+
+void WriteBehindPipeline::handle_reboot() {
+    const auto code = run();
+    if (code != status::StatusCode::OK) {
+        ocs_loge(log_tag, "failed to commit pending writes before reboot: %s",
+                 status::code_to_str(code));
+    }
+}
+
+} // namespace bonsai
+} // namespace ocs
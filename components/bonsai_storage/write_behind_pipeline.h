@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ocs_core/iclock.h"
+#include "ocs_core/noncopyable.h"
+#include "ocs_core/time.h"
+#include "ocs_fmt/json/fanout_formatter.h"
+#include "ocs_http/irouter.h"
+#include "ocs_scheduler/itask.h"
+#include "ocs_scheduler/itask_scheduler.h"
+#include "ocs_storage/istorage.h"
+#include "ocs_storage/storage_builder.h"
+#include "ocs_system/fanout_reboot_handler.h"
+#include "ocs_system/ireboot_handler.h"
+
+#include "bonsai_core/static_mutex.h"
+#include "bonsai_http/json_stream_handler.h"
+#include "bonsai_storage/write_behind_storage.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Create storages with the write-behind cache.
+//!
+//! @remarks
+//!  - Pending writes are committed periodically and before reboot.
+//!  - Per-key statistics are available via GET /api/v1/diagnostic/storage.
+//!  - The pipeline is also a task scheduler for the tasks which save the state to
+//!    the storages created elsewhere, e.g. the FSM blocks of the sensor pipelines, see
+//!    SensorTaskScheduler. Such tasks are run on commit, once their interval has
+//!    elapsed, so all flash writes are done together.
+//!
+//!  If CONFIG_BONSAI_FIRMWARE_STORAGE_WRITE_BEHIND_ENABLE is disabled, the storages
+//!  are created as is, and the tasks are registered in the underlying scheduler.
+class WriteBehindPipeline : public scheduler::ITask,
+                            public scheduler::ITaskScheduler,
+                            public system::IRebootHandler,
+                            public core::NonCopyable<> {
+public:
+    //! Initialize.
+    WriteBehindPipeline(core::IClock& clock,
+                        storage::StorageBuilder& storage_builder,
+                        scheduler::ITaskScheduler& task_scheduler,
+                        system::FanoutRebootHandler& reboot_handler,
+                        http::IRouter& router);
+
+    //! Create the storage with @p id.
+    //!
+    //! @notes
+    //!  The storage is owned by the pipeline.
+    storage::IStorage& make(const char* id);
+
+    //! Register @p task to be run on commit, once @p interval has elapsed.
+    status::StatusCode
+    add(scheduler::ITask& task, const char* id, core::Time interval) override;
+
+    //! Commit the pending writes and run the due tasks.
+    //!
+    //! @notes
+    //!  Serialized with the commit before reboot.
+    status::StatusCode run() override;
+
+    //! Commit the pending writes before reboot.
+    void handle_reboot() override;
+
+private:
+    struct Task {
+        scheduler::ITask* task { nullptr };
+        const char* id { nullptr };
+        core::Time interval { 0 };
+        core::Time last_run { 0 };
+    };
+
+    core::IClock& clock_;
+    storage::StorageBuilder& storage_builder_;
+    scheduler::ITaskScheduler& task_scheduler_;
+
+    StaticMutex mu_;
+
+    std::vector<Task> tasks_;
+
+    std::vector<storage::StorageBuilder::IStoragePtr> storages_;
+    std::vector<std::unique_ptr<WriteBehindStorage>> caches_;
+
+    std::unique_ptr<fmt::json::FanoutFormatter> formatter_;
+    std::unique_ptr<JsonStreamHandler> handler_;
+};
+
+} // namespace bonsai
+} // namespace ocs
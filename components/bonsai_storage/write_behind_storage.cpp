@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+#include <new>
+
+#include "freertos/FreeRTOS.h"
+
+#include "ocs_core/log.h"
+#include "ocs_fmt/json/cjson_object_formatter.h"
+#include "ocs_status/code_to_str.h"
+
+#include "bonsai_core/alloc_tracker.h"
+#include "bonsai_core/deferred_log.h"
+#include "bonsai_core/tracer.h"
+#include "bonsai_storage/write_behind_storage.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const char* log_tag = "write_behind_storage";
+
+} // namespace
+
+WriteBehindStorage::WriteBehindStorage(storage::IStorage& storage,
+                                       const char* id,
+                                       Params params)
+    : id_(id)
+    , params_(params)
+    , storage_(storage) {
+    configASSERT(params_.max_key_count);
+    configASSERT(params_.max_value_size);
+
+    entries_.reset(new (std::nothrow) Entry[params_.max_key_count]);
+    configASSERT(entries_);
+
+    values_.reset(new (std::nothrow)
+                      uint8_t[params_.max_key_count * params_.max_value_size]);
+    configASSERT(values_);
+
+    for (unsigned n = 0; n < params_.max_key_count; ++n) {
+        entries_[n].value = values_.get() + n * params_.max_value_size;
+    }
+}
+
+status::StatusCode WriteBehindStorage::probe(const char* key, unsigned& size) {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    const Entry* entry = find_(key);
+    if (entry) {
+        if (entry->state == State::Erased) {
+            return status::StatusCode::NoData;
+        }
+
+        if (entry->has_value) {
+            size = entry->size;
+            return status::StatusCode::OK;
+        }
+    }
+
+    return storage_.probe(key, size);
+}
+
+status::StatusCode WriteBehindStorage::read(const char* key, void* data, unsigned size) {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    const Entry* entry = find_(key);
+    if (entry) {
+        if (entry->state == State::Erased) {
+            return status::StatusCode::NoData;
+        }
+
+        if (entry->has_value) {
+            if (size < entry->size) {
+                return status::StatusCode::InvalidArg;
+            }
+
+            memcpy(data, entry->value, entry->size);
+            return status::StatusCode::OK;
+        }
+    }
+
+    return storage_.read(key, data, size);
+}
+
+status::StatusCode
+WriteBehindStorage::write(const char* key, const void* data, unsigned size) {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    Entry* entry = find_(key);
+    if (!entry) {
+        entry = add_(key);
+    }
+
+    if (!entry || size > params_.max_value_size) {
+        TraceScope trace_scope("storage", id_);
+
+        if (entry) {
+            ++entry->write_count;
+
+            // The cached value is superseded, it shouldn't be committed by the next
+            // flush even if the direct write fails.
+            entry->state = State::Clean;
+            entry->has_value = false;
+        }
+
+        const auto code = storage_.write(key, data, size);
+
+        if (entry && code == status::StatusCode::OK) {
+            ++entry->commit_count;
+        }
+
+        return code;
+    }
+
+    ++entry->write_count;
+
+    if (entry->state != State::Erased && entry->has_value && entry->size == size
+        && memcmp(entry->value, data, size) == 0) {
+        return status::StatusCode::OK;
+    }
+
+    memcpy(entry->value, data, size);
+    entry->size = size;
+    entry->has_value = true;
+    entry->state = State::Dirty;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WriteBehindStorage::erase(const char* key) {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    Entry* entry = find_(key);
+    if (!entry) {
+        entry = add_(key);
+    }
+
+    if (!entry) {
+        return storage_.erase(key);
+    }
+
+    ++entry->write_count;
+
+    entry->state = State::Erased;
+    entry->has_value = false;
+
+    return status::StatusCode::OK;
+}
+
+status::StatusCode WriteBehindStorage::erase_all() {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    count_ = 0;
+
+    return storage_.erase_all();
+}
+
+status::StatusCode WriteBehindStorage::flush() {
+    AllocScope alloc_scope(AllocDomain::Storage);
+    MutexLock lock(mu_);
+
+    auto result = status::StatusCode::OK;
+
+    for (unsigned n = 0; n < count_; ++n) {
+        Entry& entry = entries_[n];
+
+        auto code = status::StatusCode::OK;
+
+        switch (entry.state) {
+        case State::Clean:
+            continue;
+
+        case State::Dirty: {
+            TraceScope trace_scope("storage", id_);
+
+            code = storage_.write(entry.key, entry.value, entry.size);
+            break;
+        }
+
+        case State::Erased: {
+            TraceScope trace_scope("storage", id_);
+
+            code = storage_.erase(entry.key);
+            if (code == status::StatusCode::NoData) {
+                code = status::StatusCode::OK;
+            }
+            break;
+        }
+        }
+
+        if (code != status::StatusCode::OK) {
+            bonsai_loge(log_tag, "failed to commit: id=%s key=%s code=%s", id_, entry.key,
+                        status::code_to_str(code));
+
+            result = code;
+            continue;
+        }
+
+        entry.state = State::Clean;
+        ++entry.commit_count;
+    }
+
+    return result;
+}
+
+status::StatusCode WriteBehindStorage::format(cJSON* json) {
+    MutexLock lock(mu_);
+
+    cJSON* storage_json = cJSON_AddObjectToObject(json, id_);
+    if (!storage_json) {
+        return status::StatusCode::NoMem;
+    }
+
+    for (unsigned n = 0; n < count_; ++n) {
+        const Entry& entry = entries_[n];
+
+        cJSON* entry_json = cJSON_AddObjectToObject(storage_json, entry.key);
+        if (!entry_json) {
+            return status::StatusCode::NoMem;
+        }
+
+        fmt::json::CjsonObjectFormatter formatter(entry_json);
+
+        if (!formatter.add_number_cs("writes", entry.write_count)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_number_cs("commits", entry.commit_count)) {
+            return status::StatusCode::NoMem;
+        }
+
+        if (!formatter.add_bool_cs("pending", entry.state != State::Clean)) {
+            return status::StatusCode::NoMem;
+        }
+    }
+
+    return status::StatusCode::OK;
+}
+
+WriteBehindStorage::Entry* WriteBehindStorage::find_(const char* key) {
+    for (unsigned n = 0; n < count_; ++n) {
+        if (strcmp(entries_[n].key, key) == 0) {
+            return &entries_[n];
+        }
+    }
+
+    return nullptr;
+}
+
+WriteBehindStorage::Entry* WriteBehindStorage::add_(const char* key) {
+    if (count_ == params_.max_key_count || strlen(key) >= max_key_size_) {
+        return nullptr;
+    }
+
+    Entry& entry = entries_[count_++];
+
+    strcpy(entry.key, key);
+    entry.state = State::Clean;
+    entry.has_value = false;
+    entry.size = 0;
+    entry.write_count = 0;
+    entry.commit_count = 0;
+
+    return &entry;
+}
+
+} // namespace bonsai
+} // namespace ocs
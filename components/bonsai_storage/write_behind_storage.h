@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "ocs_core/noncopyable.h"
+#include "ocs_fmt/json/iformatter.h"
+#include "ocs_storage/istorage.h"
+
+#include "bonsai_core/static_mutex.h"
+
+namespace ocs {
+namespace bonsai {
+
+//! Keep the recent writes in RAM and commit them to the underlying storage later.
+//!
+//! @remarks
+//!  - Repeated writes of the same value are coalesced, only the last value of the key
+//!    is committed.
+//!  - Reads of the cached keys are served from RAM.
+//!  - Writes which don't fit into the cache go directly to the underlying storage.
+//!  - The number of writes and the number of commits is tracked for each key.
+class WriteBehindStorage : public storage::IStorage,
+                           public fmt::json::IFormatter,
+                           public core::NonCopyable<> {
+public:
+    struct Params {
+        //! Maximum number of the cached keys.
+        unsigned max_key_count { 0 };
+
+        //! Maximum size of the cached value, in bytes.
+        unsigned max_value_size { 0 };
+    };
+
+    //! Initialize.
+    //!
+    //! @params
+    //!  - @p storage to commit the writes to.
+    //!  - @p id - storage identifier, used in the statistics.
+    WriteBehindStorage(storage::IStorage& storage, const char* id, Params params);
+
+    //! Return the size of the value for @p key.
+    status::StatusCode probe(const char* key, unsigned& size) override;
+
+    //! Read the value for @p key.
+    status::StatusCode read(const char* key, void* data, unsigned size) override;
+
+    //! Write the value for @p key.
+    status::StatusCode write(const char* key, const void* data, unsigned size) override;
+
+    //! Erase the value for @p key.
+    status::StatusCode erase(const char* key) override;
+
+    //! Drop the cache and erase all values.
+    status::StatusCode erase_all() override;
+
+    //! Commit the pending writes to the underlying storage.
+    status::StatusCode flush();
+
+    //! Format the per-key statistics into @p json.
+    status::StatusCode format(cJSON* json) override;
+
+private:
+    // NVS limit, including the null terminator.
+    static constexpr unsigned max_key_size_ = 16;
+
+    enum class State : uint8_t {
+        //! Value matches the underlying storage.
+        Clean,
+
+        //! Value should be written to the underlying storage.
+        Dirty,
+
+        //! Value should be erased from the underlying storage.
+        Erased,
+    };
+
+    struct Entry {
+        char key[max_key_size_];
+        State state { State::Clean };
+        bool has_value { false };
+        unsigned size { 0 };
+        uint8_t* value { nullptr };
+        uint32_t write_count { 0 };
+        uint32_t commit_count { 0 };
+    };
+
+    Entry* find_(const char* key);
+    Entry* add_(const char* key);
+
+    const char* id_ { nullptr };
+    const Params params_;
+
+    storage::IStorage& storage_;
+
+    StaticMutex mu_;
+
+    std::unique_ptr<Entry[]> entries_;
+    std::unique_ptr<uint8_t[]> values_;
+    unsigned count_ { 0 };
+};
+
+} // namespace bonsai
+} // namespace ocs
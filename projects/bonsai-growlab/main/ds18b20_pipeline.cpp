@@ -13,6 +13,11 @@
 #include "ocs_algo/bit_ops.h"
 #include "ocs_pipeline/jsonfmt/ds18b20_sensor_formatter.h"
 
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+#include "bonsai_sensor/adaptive_sampler_formatter.h"
+#include "bonsai_sensor/ds18b20_signal.h"
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
 #include "main/ds18b20_pipeline.h"
 
 namespace ocs {
@@ -42,18 +47,29 @@ void configure_onewire_gpio(int gpio) {
 #endif // defined(CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_ENABLE) ||
        // defined(CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_ENABLE)
 
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+// Significant temperature change, in degrees Celsius.
+const float temperature_signal_threshold =
+    CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_TEMPERATURE_THRESHOLD / 100.0;
+
+const core::Time signal_rate_window =
+    core::Duration::second * CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_RATE_WINDOW;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
 } // namespace
 
 DS18B20Pipeline::DS18B20Pipeline(core::IClock& clock,
-                                 storage::StorageBuilder& storage_builder,
+                                 WriteBehindPipeline& write_behind_pipeline,
+                                 WarmStartPipeline& warm_start_pipeline,
+                                 MqttPipeline& mqtt_pipeline,
+                                 EventBusPipeline& event_bus_pipeline,
                                  scheduler::ITaskScheduler& task_scheduler,
+                                 SamplingScheduler* sampling_scheduler,
                                  fmt::json::FanoutFormatter& telemetry_formatter,
                                  system::IRtDelayer& delayer,
                                  system::ISuspender& suspender,
-                                 http::IRouter& router) {
-    storage_ = storage_builder.make("ds18b20_sensors");
-    configASSERT(storage_);
-
+                                 http::IRouter& router)
+    : storage_(write_behind_pipeline.make("ds18b20_sensors")) {
     store_.reset(new (std::nothrow) sensor::ds18b20::Store(delayer, 8));
     configASSERT(store_);
 
@@ -62,13 +78,25 @@ DS18B20Pipeline::DS18B20Pipeline(core::IClock& clock,
     configASSERT(sensor_http_handler_);
 
 #ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_ENABLE
+    const core::Time soil_temperature_read_interval = core::Duration::second
+        * CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_READ_INTERVAL;
+
+    soil_temperature_scheduler_.reset(new (std::nothrow) SensorTaskScheduler(
+        task_scheduler,
+        SensorTaskScheduler::Params {
+            .id = "soil_temp",
+            .read_task_id = "soil_temp",
+            .read_interval = soil_temperature_read_interval,
+            .sampling_scheduler = sampling_scheduler,
+        }));
+    configASSERT(soil_temperature_scheduler_);
+
     soil_temperature_pipeline_.reset(new (std::nothrow) sensor::ds18b20::SensorPipeline(
-        task_scheduler, *storage_, *store_, "soil_temp",
+        *soil_temperature_scheduler_, storage_, *store_, "soil_temp",
         sensor::ds18b20::SensorPipeline::Params {
             .data_pin = static_cast<io::gpio::Gpio>(
                 CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_DATA_GPIO),
-            .read_interval = core::Duration::second
-                * CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_READ_INTERVAL,
+            .read_interval = soil_temperature_read_interval,
         }));
     configASSERT(soil_temperature_pipeline_);
 
@@ -77,20 +105,72 @@ DS18B20Pipeline::DS18B20Pipeline(core::IClock& clock,
             soil_temperature_pipeline_->get_sensor()));
     configASSERT(soil_temperature_json_formatter_);
 
-    telemetry_formatter.add(*soil_temperature_json_formatter_);
+    soil_temperature_snapshot_formatter_.reset(
+        new (std::nothrow) SnapshotFormatter(*soil_temperature_json_formatter_));
+    configASSERT(soil_temperature_snapshot_formatter_);
+
+    soil_temperature_scheduler_->add_handler(*soil_temperature_snapshot_formatter_);
+
+    telemetry_formatter.add(warm_start_pipeline.wrap(
+        *soil_temperature_snapshot_formatter_, "soil_temp",
+        { soil_temperature_scheduler_.get() }));
+
+    mqtt_pipeline.add(*soil_temperature_snapshot_formatter_, "soil_temp",
+                      EventBus::Filter {
+                          .sensor_id = "soil_temp",
+                      });
+    event_bus_pipeline.add(soil_temperature_pipeline_->get_sensor(), "soil_temp",
+                           *soil_temperature_scheduler_);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    soil_temperature_signal_.reset(new (std::nothrow) DS18B20Signal(
+        soil_temperature_pipeline_->get_sensor(), temperature_signal_threshold,
+        signal_rate_window));
+    configASSERT(soil_temperature_signal_);
+
+    soil_temperature_sampler_.reset(new (std::nothrow) AdaptiveSampler(
+        clock, *soil_temperature_signal_,
+        AdaptiveSampler::Params {
+            .min_interval = soil_temperature_read_interval,
+            .max_interval =
+                AdaptiveSampler::get_max_interval(soil_temperature_read_interval),
+        }));
+    configASSERT(soil_temperature_sampler_);
+
+    soil_temperature_scheduler_->set_sampler(*soil_temperature_sampler_);
+
+    soil_temperature_sampler_json_formatter_.reset(
+        new (std::nothrow) AdaptiveSamplerFormatter(*soil_temperature_sampler_,
+                                                    "soil_temp"));
+    configASSERT(soil_temperature_sampler_json_formatter_);
+
+    telemetry_formatter.add(*soil_temperature_sampler_json_formatter_);
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 
     configure_onewire_gpio(
         CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_DATA_GPIO);
 #endif // CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_ENABLE
 
 #ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_ENABLE
+    const core::Time outside_temperature_read_interval = core::Duration::second
+        * CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_READ_INTERVAL;
+
+    outside_temperature_scheduler_.reset(new (std::nothrow) SensorTaskScheduler(
+        task_scheduler,
+        SensorTaskScheduler::Params {
+            .id = "outside_temp",
+            .read_task_id = "outside_temp",
+            .read_interval = outside_temperature_read_interval,
+            .sampling_scheduler = sampling_scheduler,
+        }));
+    configASSERT(outside_temperature_scheduler_);
+
     outside_temperature_pipeline_.reset(new (std::nothrow) sensor::ds18b20::SensorPipeline(
-        task_scheduler, *storage_, *store_, "outside_temp",
+        *outside_temperature_scheduler_, storage_, *store_, "outside_temp",
         sensor::ds18b20::SensorPipeline::Params {
             .data_pin = static_cast<io::gpio::Gpio>(
                 CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_DATA_GPIO),
-            .read_interval = core::Duration::second
-                * CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_READ_INTERVAL,
+            .read_interval = outside_temperature_read_interval,
         }));
     configASSERT(outside_temperature_pipeline_);
 
@@ -99,7 +179,47 @@ DS18B20Pipeline::DS18B20Pipeline(core::IClock& clock,
             outside_temperature_pipeline_->get_sensor()));
     configASSERT(outside_temperature_json_formatter_);
 
-    telemetry_formatter.add(*outside_temperature_json_formatter_);
+    outside_temperature_snapshot_formatter_.reset(
+        new (std::nothrow) SnapshotFormatter(*outside_temperature_json_formatter_));
+    configASSERT(outside_temperature_snapshot_formatter_);
+
+    outside_temperature_scheduler_->add_handler(*outside_temperature_snapshot_formatter_);
+
+    telemetry_formatter.add(warm_start_pipeline.wrap(
+        *outside_temperature_snapshot_formatter_, "outside_temp",
+        { outside_temperature_scheduler_.get() }));
+
+    mqtt_pipeline.add(*outside_temperature_snapshot_formatter_, "outside_temp",
+                      EventBus::Filter {
+                          .sensor_id = "outside_temp",
+                      });
+    event_bus_pipeline.add(outside_temperature_pipeline_->get_sensor(), "outside_temp",
+                           *outside_temperature_scheduler_);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    outside_temperature_signal_.reset(new (std::nothrow) DS18B20Signal(
+        outside_temperature_pipeline_->get_sensor(), temperature_signal_threshold,
+        signal_rate_window));
+    configASSERT(outside_temperature_signal_);
+
+    outside_temperature_sampler_.reset(new (std::nothrow) AdaptiveSampler(
+        clock, *outside_temperature_signal_,
+        AdaptiveSampler::Params {
+            .min_interval = outside_temperature_read_interval,
+            .max_interval =
+                AdaptiveSampler::get_max_interval(outside_temperature_read_interval),
+        }));
+    configASSERT(outside_temperature_sampler_);
+
+    outside_temperature_scheduler_->set_sampler(*outside_temperature_sampler_);
+
+    outside_temperature_sampler_json_formatter_.reset(
+        new (std::nothrow) AdaptiveSamplerFormatter(*outside_temperature_sampler_,
+                                                    "outside_temp"));
+    configASSERT(outside_temperature_sampler_json_formatter_);
+
+    telemetry_formatter.add(*outside_temperature_sampler_json_formatter_);
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 
     configure_onewire_gpio(
         CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_DATA_GPIO);
@@ -17,9 +17,17 @@
 #include "ocs_scheduler/idelay_estimator.h"
 #include "ocs_scheduler/itask_scheduler.h"
 #include "ocs_sensor/ds18b20/sensor_pipeline.h"
-#include "ocs_storage/storage_builder.h"
 #include "ocs_system/isuspender.h"
 
+#include "bonsai_event/event_bus_pipeline.h"
+#include "bonsai_mqtt/mqtt_pipeline.h"
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/sampling_scheduler.h"
+#include "bonsai_sensor/sensor_task_scheduler.h"
+#include "bonsai_sensor/snapshot_formatter.h"
+#include "bonsai_storage/warm_start_pipeline.h"
+#include "bonsai_storage/write_behind_pipeline.h"
+
 namespace ocs {
 namespace bonsai {
 
@@ -27,26 +35,47 @@ class DS18B20Pipeline : public core::NonCopyable<> {
 public:
     //! Initialize.
     DS18B20Pipeline(core::IClock& clock,
-                    storage::StorageBuilder& storage_builder,
+                    WriteBehindPipeline& write_behind_pipeline,
+                    WarmStartPipeline& warm_start_pipeline,
+                    MqttPipeline& mqtt_pipeline,
+                    EventBusPipeline& event_bus_pipeline,
                     scheduler::ITaskScheduler& task_scheduler,
+                    SamplingScheduler* sampling_scheduler,
                     fmt::json::FanoutFormatter& telemetry_formatter,
                     system::IRtDelayer& delayer,
                     system::ISuspender& suspender,
                     http::IRouter& router);
 
 private:
-    std::unique_ptr<storage::IStorage> storage_;
+    storage::IStorage& storage_;
+
     std::unique_ptr<sensor::ds18b20::Store> store_;
     std::unique_ptr<pipeline::httpserver::DS18B20Handler> sensor_http_handler_;
 
 #ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_ENABLE
+    std::unique_ptr<SensorTaskScheduler> soil_temperature_scheduler_;
     std::unique_ptr<sensor::ds18b20::SensorPipeline> soil_temperature_pipeline_;
     std::unique_ptr<fmt::json::IFormatter> soil_temperature_json_formatter_;
+    std::unique_ptr<SnapshotFormatter> soil_temperature_snapshot_formatter_;
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    std::unique_ptr<AdaptiveSampler::ISignal> soil_temperature_signal_;
+    std::unique_ptr<AdaptiveSampler> soil_temperature_sampler_;
+    std::unique_ptr<fmt::json::IFormatter> soil_temperature_sampler_json_formatter_;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 #endif // CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_SOIL_TEMPERATURE_ENABLE
 
 #ifdef CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_ENABLE
+    std::unique_ptr<SensorTaskScheduler> outside_temperature_scheduler_;
     std::unique_ptr<sensor::ds18b20::SensorPipeline> outside_temperature_pipeline_;
     std::unique_ptr<fmt::json::IFormatter> outside_temperature_json_formatter_;
+    std::unique_ptr<SnapshotFormatter> outside_temperature_snapshot_formatter_;
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    std::unique_ptr<AdaptiveSampler::ISignal> outside_temperature_signal_;
+    std::unique_ptr<AdaptiveSampler> outside_temperature_sampler_;
+    std::unique_ptr<fmt::json::IFormatter> outside_temperature_sampler_json_formatter_;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 #endif // CONFIG_BONSAI_FIRMWARE_SENSOR_DS18B20_OUTSIDE_TEMPERATURE_ENABLE
 };
 
@@ -6,9 +6,13 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "bonsai_core/boot_profiler.h"
+
 #include "project_pipeline.h"
 
 extern "C" void app_main(void) {
+    ocs::bonsai::BootProfiler::mark("app_main");
+
     ocs::bonsai::ProjectPipeline pipeline;
     pipeline.start();
 }
@@ -8,20 +8,40 @@
 
 #include "ocs_pipeline/jsonfmt/sht41_sensor_formatter.h"
 
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+#include "bonsai_sensor/adaptive_sampler_formatter.h"
+#include "bonsai_sensor/sht41_signal.h"
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
 #include "main/sht41_pipeline.h"
 
 namespace ocs {
 namespace bonsai {
 
-SHT41Pipeline::SHT41Pipeline(io::i2c::IStore& i2c_store,
+SHT41Pipeline::SHT41Pipeline(core::IClock& clock,
+                             io::i2c::IStore& i2c_store,
                              scheduler::ITaskScheduler& task_scheduler,
+                             SamplingScheduler* sampling_scheduler,
                              scheduler::AsyncFuncScheduler& func_scheduler,
                              storage::StorageBuilder& storage_builder,
+                             WarmStartPipeline& warm_start_pipeline,
+                             MqttPipeline& mqtt_pipeline,
+                             EventBusPipeline& event_bus_pipeline,
                              fmt::json::FanoutFormatter& telemetry_formatter,
                              http::IRouter& router,
                              core::Time read_interval) {
+    sensor_scheduler_.reset(new (std::nothrow) SensorTaskScheduler(
+        task_scheduler,
+        SensorTaskScheduler::Params {
+            .id = "sht41",
+            .read_task_id = "sht41",
+            .read_interval = read_interval,
+            .sampling_scheduler = sampling_scheduler,
+        }));
+    configASSERT(sensor_scheduler_);
+
     sensor_pipeline_.reset(new (std::nothrow) sensor::sht41::SensorPipeline(
-        i2c_store, task_scheduler, storage_builder,
+        i2c_store, *sensor_scheduler_, storage_builder,
         sensor::sht41::SensorPipeline::Params {
             .read_interval = read_interval,
             .measure_command = sensor::sht41::Sensor::Command::MeasureLowPrecision,
@@ -34,11 +54,51 @@ SHT41Pipeline::SHT41Pipeline(io::i2c::IStore& i2c_store,
             pipeline::jsonfmt::SHT41SensorFormatter(sensor_pipeline_->get_sensor()));
     configASSERT(sensor_json_formatter_);
 
-    telemetry_formatter.add(*sensor_json_formatter_);
+    sensor_snapshot_formatter_.reset(
+        new (std::nothrow) SnapshotFormatter(*sensor_json_formatter_));
+    configASSERT(sensor_snapshot_formatter_);
+
+    sensor_scheduler_->add_handler(*sensor_snapshot_formatter_);
+
+    telemetry_formatter.add(
+        warm_start_pipeline.wrap(*sensor_snapshot_formatter_, "sht41",
+                                 { sensor_scheduler_.get() }));
+
+    mqtt_pipeline.add(*sensor_snapshot_formatter_, "sht41",
+                      EventBus::Filter {
+                          .sensor_id = "sht41",
+                      });
+    event_bus_pipeline.add(sensor_pipeline_->get_sensor(), "sht41", *sensor_scheduler_);
 
     sensor_http_handler_.reset(new (std::nothrow) pipeline::httpserver::SHT41Handler(
         func_scheduler, router, sensor_pipeline_->get_sensor()));
     configASSERT(sensor_http_handler_);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    sensor_signal_.reset(new (std::nothrow) SHT41Signal(
+        sensor_pipeline_->get_sensor(),
+        CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_TEMPERATURE_THRESHOLD / 100.0,
+        CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_HUMIDITY_THRESHOLD / 100.0,
+        core::Duration::second * CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_RATE_WINDOW));
+    configASSERT(sensor_signal_);
+
+    sensor_sampler_.reset(new (std::nothrow) AdaptiveSampler(
+        clock, *sensor_signal_,
+        AdaptiveSampler::Params {
+            .min_interval = read_interval,
+            .max_interval = AdaptiveSampler::get_max_interval(read_interval),
+        }));
+    configASSERT(sensor_sampler_);
+
+    sensor_scheduler_->set_sampler(*sensor_sampler_);
+
+    sensor_sampler_json_formatter_.reset(new (std::nothrow)
+                                             AdaptiveSamplerFormatter(*sensor_sampler_,
+                                                                      "sht41"));
+    configASSERT(sensor_sampler_json_formatter_);
+
+    telemetry_formatter.add(*sensor_sampler_json_formatter_);
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 }
 
 } // namespace bonsai
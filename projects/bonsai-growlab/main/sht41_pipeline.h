@@ -10,6 +10,7 @@
 
 #include <memory>
 
+#include "ocs_core/iclock.h"
 #include "ocs_core/noncopyable.h"
 #include "ocs_core/time.h"
 #include "ocs_fmt/json/fanout_formatter.h"
@@ -20,24 +21,45 @@
 #include "ocs_sensor/sht41/sensor_pipeline.h"
 #include "ocs_storage/storage_builder.h"
 
+#include "bonsai_event/event_bus_pipeline.h"
+#include "bonsai_mqtt/mqtt_pipeline.h"
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/sampling_scheduler.h"
+#include "bonsai_sensor/sensor_task_scheduler.h"
+#include "bonsai_sensor/snapshot_formatter.h"
+#include "bonsai_storage/warm_start_pipeline.h"
+
 namespace ocs {
 namespace bonsai {
 
 class SHT41Pipeline : public core::NonCopyable<> {
 public:
     //! Initialize.
-    SHT41Pipeline(io::i2c::IStore& i2c_store,
+    SHT41Pipeline(core::IClock& clock,
+                  io::i2c::IStore& i2c_store,
                   scheduler::ITaskScheduler& task_scheduler,
+                  SamplingScheduler* sampling_scheduler,
                   scheduler::AsyncFuncScheduler& func_scheduler,
                   storage::StorageBuilder& storage_builder,
+                  WarmStartPipeline& warm_start_pipeline,
+                  MqttPipeline& mqtt_pipeline,
+                  EventBusPipeline& event_bus_pipeline,
                   fmt::json::FanoutFormatter& telemetry_formatter,
                   http::IRouter& router,
                   core::Time read_interval);
 
 private:
+    std::unique_ptr<SensorTaskScheduler> sensor_scheduler_;
     std::unique_ptr<sensor::sht41::SensorPipeline> sensor_pipeline_;
     std::unique_ptr<fmt::json::IFormatter> sensor_json_formatter_;
+    std::unique_ptr<SnapshotFormatter> sensor_snapshot_formatter_;
     std::unique_ptr<pipeline::httpserver::SHT41Handler> sensor_http_handler_;
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    std::unique_ptr<AdaptiveSampler::ISignal> sensor_signal_;
+    std::unique_ptr<AdaptiveSampler> sensor_sampler_;
+    std::unique_ptr<fmt::json::IFormatter> sensor_sampler_json_formatter_;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 };
 
 } // namespace bonsai
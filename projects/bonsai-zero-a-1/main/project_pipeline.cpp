@@ -6,6 +6,8 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <cstdio>
+
 #include "ocs_algo/mdns_ops.h"
 #include "ocs_core/log.h"
 #include "ocs_http/router.h"
@@ -19,6 +21,14 @@
 #include "ocs_status/code_to_str.h"
 #include "ocs_status/macros.h"
 
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+#include "bonsai_sensor/adaptive_sampler_formatter.h"
+#include "bonsai_sensor/soil_analog_signal.h"
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
+#include "bonsai_core/arena_scope.h"
+#include "bonsai_core/boot_profiler.h"
+
 #include "main/project_pipeline.h"
 
 namespace ocs {
@@ -28,9 +38,22 @@ namespace {
 
 const char* log_tag = "project_pipeline";
 
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+// Significant soil moisture change, in percents.
+const float soil_signal_threshold =
+    CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_SOIL_MOISTURE_THRESHOLD / 100.0;
+
+const core::Time signal_rate_window =
+    core::Duration::second * CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_RATE_WINDOW;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
 } // namespace
 
 ProjectPipeline::ProjectPipeline() {
+    ArenaScope arena_scope;
+
+    arena_scope.begin("system");
+
     rt_delayer_ = system::PlatformBuilder::make_rt_delayer();
     configASSERT(rt_delayer_);
 
@@ -41,36 +64,78 @@ ProjectPipeline::ProjectPipeline() {
         pipeline::basic::SystemPipeline::Params {
             .task_scheduler =
                 pipeline::basic::SystemPipeline::Params::TaskScheduler {
-                    .delay = pdMS_TO_TICKS(200),
+                    .delay = pdMS_TO_TICKS(CONFIG_BONSAI_FIRMWARE_SCHEDULER_DELAY),
                 },
         }));
     configASSERT(system_pipeline_);
 
-    configASSERT(fanout_suspender_->add(*this, "project_pipeline")
-                 == status::StatusCode::OK);
+    task_scheduler_.reset(
+        new (std::nothrow) TracingTaskScheduler(system_pipeline_->get_task_scheduler()));
+    configASSERT(task_scheduler_);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    sampling_scheduler_.reset(new (std::nothrow) SamplingScheduler(
+        system_pipeline_->get_clock(),
+        SamplingScheduler::Params {
+            .stack_size = CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_STACK_SIZE,
+            .priority = tskIDLE_PRIORITY + 1,
+        }));
+    configASSERT(sampling_scheduler_);
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
+    arena_scope.begin("data");
 
     json_data_pipeline_.reset(new (std::nothrow) pipeline::jsonfmt::DataPipeline(
         system_pipeline_->get_clock(), system_pipeline_->get_storage_builder(),
-        system_pipeline_->get_task_scheduler(), system_pipeline_->get_reboot_handler(),
+        *task_scheduler_, system_pipeline_->get_reboot_handler(),
         system_pipeline_->get_device_info()));
     configASSERT(json_data_pipeline_);
 
+    arena_scope.begin("http_router");
+
+    http_router_.reset(new (std::nothrow) http::Router());
+    configASSERT(http_router_);
+
+    instrumented_router_.reset(new (std::nothrow) InstrumentedRouter(*http_router_));
+    configASSERT(instrumented_router_);
+
+    arena_scope.begin("storage");
+
+    write_behind_pipeline_.reset(new (std::nothrow) WriteBehindPipeline(
+        system_pipeline_->get_clock(), system_pipeline_->get_storage_builder(),
+        *task_scheduler_, system_pipeline_->get_reboot_handler(),
+        *instrumented_router_));
+    configASSERT(write_behind_pipeline_);
+
+    warm_start_pipeline_.reset(new (std::nothrow) WarmStartPipeline(
+        *task_scheduler_, system_pipeline_->get_reboot_handler()));
+    configASSERT(warm_start_pipeline_);
+
+    deadband_pipeline_.reset(new (std::nothrow) DeadbandPipeline(
+        system_pipeline_->get_clock(), *write_behind_pipeline_, *instrumented_router_));
+    configASSERT(deadband_pipeline_);
+
+    arena_scope.begin("network_handler");
+
     fanout_network_handler_.reset(new (std::nothrow) net::FanoutNetworkHandler());
     configASSERT(fanout_network_handler_);
 
-    mdns_config_storage_ =
-        system_pipeline_->get_storage_builder().make(mdns_config_storage_id_);
-    configASSERT(mdns_config_storage_);
+    arena_scope.begin("mdns");
+
+    storage::IStorage& mdns_config_storage =
+        write_behind_pipeline_->make(mdns_config_storage_id_);
 
     mdns_config_.reset(new (std::nothrow) net::MdnsConfig(
-        *mdns_config_storage_, system_pipeline_->get_device_info()));
+        mdns_config_storage, system_pipeline_->get_device_info()));
     configASSERT(mdns_config_);
 
-    const auto mdns_instance_name = std::string("Bonsai Zero Analog 1 HTTP Service (")
-        + system_pipeline_->get_device_info().get_fw_name() + ")";
+    char mdns_instance_name[64];
+    snprintf(mdns_instance_name, sizeof(mdns_instance_name),
+             "Bonsai Zero Analog 1 HTTP Service (%s)",
+             system_pipeline_->get_device_info().get_fw_name());
 
     http_mdns_service_.reset(new (std::nothrow) net::MdnsService(
-        mdns_instance_name.c_str(), net::MdnsService::ServiceType::Http,
+        mdns_instance_name, net::MdnsService::ServiceType::Http,
         net::MdnsService::Proto::Tcp, "local", mdns_config_->get_hostname(),
         CONFIG_OCS_HTTP_SERVER_PORT));
     configASSERT(http_mdns_service_);
@@ -87,8 +152,7 @@ ProjectPipeline::ProjectPipeline() {
 
     mdns_server_->add(*http_mdns_service_);
 
-    http_router_.reset(new (std::nothrow) http::Router());
-    configASSERT(http_router_);
+    arena_scope.begin("http_server");
 
     http_server_.reset(new (std::nothrow) http::Server(
         *http_router_,
@@ -98,28 +162,61 @@ ProjectPipeline::ProjectPipeline() {
         }));
     configASSERT(http_server_);
 
+    json_stream_pipeline_.reset(new (std::nothrow) JsonStreamPipeline(
+        *instrumented_router_, *fanout_network_handler_,
+        json_data_pipeline_->get_telemetry_formatter(),
+        json_data_pipeline_->get_registration_formatter(), 1733215816));
+    configASSERT(json_stream_pipeline_);
+
     http_pipeline_.reset(new (std::nothrow) pipeline::httpserver::HttpPipeline(
         system_pipeline_->get_reboot_task(), *fanout_network_handler_, *mdns_config_,
-        *http_server_, *http_router_, json_data_pipeline_->get_telemetry_formatter(),
+        *http_server_, json_stream_pipeline_->get_router(),
+        json_data_pipeline_->get_telemetry_formatter(),
         json_data_pipeline_->get_registration_formatter(),
         pipeline::httpserver::HttpPipeline::Params {
             .telemetry =
                 pipeline::httpserver::HttpPipeline::DataParams {
-                    .buffer_size = CONFIG_BONSAI_FIRMWARE_HTTP_TELEMETRY_BUFFER_SIZE,
+                    .buffer_size = JsonStreamPipeline::upstream_buffer_size,
                 },
             .registration =
                 pipeline::httpserver::HttpPipeline::DataParams {
-                    .buffer_size = CONFIG_BONSAI_FIRMWARE_HTTP_REGISTRATION_BUFFER_SIZE,
+                    .buffer_size = JsonStreamPipeline::upstream_buffer_size,
                 },
         }));
     configASSERT(http_pipeline_);
 
+    event_bus_pipeline_.reset(new (std::nothrow) EventBusPipeline(
+        system_pipeline_->get_clock(), *instrumented_router_));
+    configASSERT(event_bus_pipeline_);
+
+    mqtt_pipeline_.reset(new (std::nothrow) MqttPipeline(
+        system_pipeline_->get_clock(), *task_scheduler_,
+        json_data_pipeline_->get_telemetry_formatter(), *deadband_pipeline_,
+        *event_bus_pipeline_, mdns_config_->get_hostname()));
+    configASSERT(mqtt_pipeline_);
+
+    beacon_pipeline_.reset(new (std::nothrow) BeaconPipeline(
+        *task_scheduler_, *instrumented_router_,
+        json_data_pipeline_->get_telemetry_formatter(), *deadband_pipeline_));
+    configASSERT(beacon_pipeline_);
+
+    format_bench_pipeline_.reset(new (std::nothrow)
+                                 FormatBenchPipeline(*instrumented_router_));
+    configASSERT(format_bench_pipeline_);
+
+    format_bench_pipeline_->add(json_data_pipeline_->get_telemetry_formatter(),
+                                "telemetry");
+    format_bench_pipeline_->add(json_data_pipeline_->get_registration_formatter(),
+                                "registration");
+
     // Time valid since 2024/12/03.
     time_pipeline_.reset(new (std::nothrow) pipeline::httpserver::TimePipeline(
-        *http_router_, json_data_pipeline_->get_telemetry_formatter(),
+        *instrumented_router_, json_data_pipeline_->get_telemetry_formatter(),
         json_data_pipeline_->get_registration_formatter(), 1733215816));
     configASSERT(time_pipeline_);
 
+    arena_scope.begin("network");
+
     network_pipeline_.reset(new (std::nothrow) pipeline::basic::SelectNetworkPipeline(
         system_pipeline_->get_storage_builder(), *fanout_network_handler_,
         system_pipeline_->get_rebooter(), system_pipeline_->get_device_info()));
@@ -131,12 +228,13 @@ ProjectPipeline::ProjectPipeline() {
         configASSERT(ap_network_formatter_);
 
         json_data_pipeline_->get_registration_formatter().add(*ap_network_formatter_);
+        format_bench_pipeline_->add(*ap_network_formatter_, "ap_network");
 
         configASSERT(network_pipeline_->get_ap_config());
 
         ap_network_handler_.reset(
             new (std::nothrow) pipeline::httpserver::ApNetworkHandler(
-                *http_router_, *network_pipeline_->get_ap_config(),
+                *instrumented_router_, *network_pipeline_->get_ap_config(),
                 system_pipeline_->get_reboot_task()));
         configASSERT(ap_network_handler_);
     }
@@ -147,13 +245,24 @@ ProjectPipeline::ProjectPipeline() {
         configASSERT(sta_network_formatter_);
 
         json_data_pipeline_->get_registration_formatter().add(*sta_network_formatter_);
+        format_bench_pipeline_->add(*sta_network_formatter_, "sta_network");
     }
 
     sta_network_handler_.reset(new (std::nothrow) pipeline::httpserver::StaNetworkHandler(
-        *http_router_, network_pipeline_->get_sta_config(),
+        *instrumented_router_, network_pipeline_->get_sta_config(),
         system_pipeline_->get_reboot_task()));
     configASSERT(sta_network_handler_);
 
+    fast_connect_pipeline_.reset(new (std::nothrow) FastConnectPipeline(
+        *write_behind_pipeline_, json_data_pipeline_->get_registration_formatter()));
+    configASSERT(fast_connect_pipeline_);
+
+    power_pipeline_.reset(new (std::nothrow) PowerPipeline(*write_behind_pipeline_,
+                                                           *instrumented_router_));
+    configASSERT(power_pipeline_);
+
+    arena_scope.begin("io");
+
     adc_store_.reset(new (std::nothrow) io::adc::OneshotStore(ADC_UNIT_1, ADC_ATTEN_DB_12,
                                                               ADC_BITWIDTH_12));
     configASSERT(adc_store_);
@@ -162,31 +271,48 @@ ProjectPipeline::ProjectPipeline() {
         ADC_UNIT_1, ADC_ATTEN_DB_12, ADC_BITWIDTH_12));
     configASSERT(adc_converter_);
 
-    analog_config_storage_ =
-        system_pipeline_->get_storage_builder().make(analog_config_storage_id_);
-    configASSERT(analog_config_storage_);
+    sensor_trace_pipeline_.reset(new (std::nothrow) SensorTracePipeline(
+        system_pipeline_->get_clock(), *adc_store_, *instrumented_router_));
+    configASSERT(sensor_trace_pipeline_);
+
+    arena_scope.begin("sensor");
+
+    storage::IStorage& analog_config_storage =
+        write_behind_pipeline_->make(analog_config_storage_id_);
 
     analog_config_store_.reset(new (std::nothrow) sensor::AnalogConfigStore());
     configASSERT(analog_config_store_);
 
-    analog_config_store_handler_.reset(new (std::nothrow)
-                                           pipeline::httpserver::AnalogConfigStoreHandler(
-                                               system_pipeline_->get_func_scheduler(),
-                                               *http_router_, *analog_config_store_));
+    analog_config_store_handler_.reset(
+        new (std::nothrow) pipeline::httpserver::AnalogConfigStoreHandler(
+            system_pipeline_->get_func_scheduler(), *instrumented_router_,
+            *analog_config_store_));
     configASSERT(analog_config_store_handler_);
 
     soil_sensor_config_.reset(new (std::nothrow) sensor::AnalogConfig(
-        *analog_config_storage_, CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_VALUE_MIN,
+        analog_config_storage, CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_VALUE_MIN,
         CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_VALUE_MAX, ADC_BITWIDTH_12,
         sensor::AnalogConfig::OversamplingMode::Mode_64, soil_sensor_id_));
     configASSERT(soil_sensor_config_);
 
     analog_config_store_->add(*soil_sensor_config_);
 
+    soil_sensor_scheduler_.reset(new (std::nothrow) SensorTaskScheduler(
+        *task_scheduler_,
+        SensorTaskScheduler::Params {
+            .id = soil_sensor_id_,
+            .read_task_id = soil_sensor_id_,
+            .read_interval = core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_READ_INTERVAL,
+            .state_scheduler = write_behind_pipeline_.get(),
+            .sampling_scheduler = sampling_scheduler_.get(),
+        }));
+    configASSERT(soil_sensor_scheduler_);
+
     soil_sensor_pipeline_.reset(new (std::nothrow) sensor::soil::AnalogSensorPipeline(
-        system_pipeline_->get_clock(), *adc_store_, *adc_converter_,
-        system_pipeline_->get_storage_builder(), *rt_delayer_,
-        system_pipeline_->get_reboot_handler(), system_pipeline_->get_task_scheduler(),
+        system_pipeline_->get_clock(), sensor_trace_pipeline_->get_store(),
+        *adc_converter_, system_pipeline_->get_storage_builder(), *rt_delayer_,
+        system_pipeline_->get_reboot_handler(), *soil_sensor_scheduler_,
         *soil_sensor_config_, soil_sensor_id_,
         sensor::soil::AnalogSensorPipeline::Params {
             .adc_channel = static_cast<io::adc::Channel>(
@@ -206,33 +332,135 @@ ProjectPipeline::ProjectPipeline() {
                                               soil_sensor_pipeline_->get_sensor()));
     configASSERT(soil_sensor_json_formatter_);
 
-    json_data_pipeline_->get_telemetry_formatter().add(*soil_sensor_json_formatter_);
+    soil_sensor_snapshot_formatter_.reset(
+        new (std::nothrow) SnapshotFormatter(*soil_sensor_json_formatter_));
+    configASSERT(soil_sensor_snapshot_formatter_);
+
+    soil_sensor_scheduler_->add_handler(*soil_sensor_snapshot_formatter_);
+
+    json_data_pipeline_->get_telemetry_formatter().add(warm_start_pipeline_->wrap(
+        *soil_sensor_snapshot_formatter_, soil_sensor_id_,
+        { soil_sensor_scheduler_.get() }));
+
+    mqtt_pipeline_->add(*soil_sensor_snapshot_formatter_, soil_sensor_id_,
+                        EventBus::Filter {
+                            .sensor_id = soil_sensor_id_,
+                        });
+    format_bench_pipeline_->add(*soil_sensor_snapshot_formatter_, soil_sensor_id_);
+    event_bus_pipeline_->add(soil_sensor_pipeline_->get_sensor(), soil_sensor_id_,
+                             *soil_sensor_scheduler_);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    soil_sensor_signal_.reset(new (std::nothrow) SoilAnalogSignal(
+        soil_sensor_pipeline_->get_sensor(), soil_signal_threshold, signal_rate_window));
+    configASSERT(soil_sensor_signal_);
+
+    soil_sensor_sampler_.reset(new (std::nothrow) AdaptiveSampler(
+        system_pipeline_->get_clock(), *soil_sensor_signal_,
+        AdaptiveSampler::Params {
+            .min_interval = core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_READ_INTERVAL,
+            .max_interval = AdaptiveSampler::get_max_interval(
+                core::Duration::second
+                * CONFIG_BONSAI_FIRMWARE_SENSOR_SOIL_ANALOG_READ_INTERVAL),
+        }));
+    configASSERT(soil_sensor_sampler_);
 
-    web_gui_pipeline_.reset(new (std::nothrow)
-                                pipeline::httpserver::WebGuiPipeline(*http_router_));
+    soil_sensor_scheduler_->set_sampler(*soil_sensor_sampler_);
+
+    soil_sensor_sampler_json_formatter_.reset(new (std::nothrow) AdaptiveSamplerFormatter(
+        *soil_sensor_sampler_, soil_sensor_id_));
+    configASSERT(soil_sensor_sampler_json_formatter_);
+
+    json_data_pipeline_->get_telemetry_formatter().add(
+        *soil_sensor_sampler_json_formatter_);
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+
+    arena_scope.begin("ota");
+
+    // Applies the pending web GUI update, so it should be created before the web GUI
+    // partition is mounted.
+    ota_pipeline_.reset(new (std::nothrow) OtaPipeline(
+        system_pipeline_->get_clock(), *fanout_network_handler_,
+        system_pipeline_->get_reboot_task(), *instrumented_router_));
+    configASSERT(ota_pipeline_);
+
+    arena_scope.begin("web_gui");
+
+    web_gui_pipeline_.reset(new (std::nothrow) pipeline::httpserver::WebGuiPipeline(
+        *instrumented_router_));
     configASSERT(web_gui_pipeline_);
-}
 
-status::StatusCode ProjectPipeline::handle_suspend() {
-    return mdns_server_->stop();
-}
+    arena_scope.begin("diagnostic");
 
-status::StatusCode ProjectPipeline::handle_resume() {
-    return mdns_server_->start();
+    heap_monitor_pipeline_.reset(new (std::nothrow) HeapMonitorPipeline(
+        system_pipeline_->get_clock(), json_data_pipeline_->get_telemetry_formatter(),
+        json_data_pipeline_->get_registration_formatter(), *instrumented_router_));
+    configASSERT(heap_monitor_pipeline_);
+
+    json_stream_pipeline_->get_dynamic_registration_formatter().add(
+        heap_monitor_pipeline_->get_formatter());
+
+    coredump_pipeline_.reset(new (std::nothrow) CoredumpPipeline(
+        json_data_pipeline_->get_registration_formatter(), *instrumented_router_));
+    configASSERT(coredump_pipeline_);
+
+    json_stream_pipeline_->get_dynamic_registration_formatter().add(
+        coredump_pipeline_->get_formatter());
+
+    boot_profile_pipeline_.reset(new (std::nothrow)
+                                     BootProfilePipeline(*instrumented_router_));
+    configASSERT(boot_profile_pipeline_);
+
+    trace_pipeline_.reset(new (std::nothrow) TracePipeline(*instrumented_router_));
+    configASSERT(trace_pipeline_);
+
+    log_pipeline_.reset(new (std::nothrow) LogPipeline(*instrumented_router_));
+    configASSERT(log_pipeline_);
+
+    network_start_task_.reset(new (std::nothrow) NetworkStartTask(
+        *network_pipeline_, *fast_connect_pipeline_, *power_pipeline_, *mdns_server_,
+        *mqtt_pipeline_));
+    configASSERT(network_start_task_);
+
+    configASSERT(fanout_suspender_->add(*network_start_task_, "network_start_task")
+                 == status::StatusCode::OK);
+
+#ifdef CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
+    network_start_oneshot_task_.reset(new (std::nothrow) OneshotTask(
+        *network_start_task_, "network_start",
+        OneshotTask::Params {
+            .stack_size = CONFIG_BONSAI_FIRMWARE_NETWORK_START_STACK_SIZE,
+            .priority = tskIDLE_PRIORITY + 1,
+        }));
+    configASSERT(network_start_oneshot_task_);
+#endif // CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
 }
 
 status::StatusCode ProjectPipeline::start() {
-    auto code = network_pipeline_->get_runner().start();
-    if (code == status::StatusCode::OK) {
-        code = mdns_server_->start();
-        if (code != status::StatusCode::OK) {
-            ocs_logw(log_tag, "failed to start mDNS server: %s",
-                     status::code_to_str(code));
-        }
-    } else {
-        ocs_logw(log_tag, "failed to start network: %s", status::code_to_str(code));
+    BootProfiler::mark("start");
+
+#ifdef CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
+    const auto code = network_start_oneshot_task_->start();
+    if (code != status::StatusCode::OK) {
+        ocs_logw(log_tag, "failed to start network in background: %s",
+                 status::code_to_str(code));
+
+        OCS_STATUS_RETURN_ON_ERROR(network_start_task_->run());
+    }
+#else
+    OCS_STATUS_RETURN_ON_ERROR(network_start_task_->run());
+#endif // CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
+
+    BootProfiler::mark("scheduler");
+
+    OCS_STATUS_RETURN_ON_ERROR(heap_monitor_pipeline_->start());
+
+    if (sampling_scheduler_) {
+        OCS_STATUS_RETURN_ON_ERROR(sampling_scheduler_->start());
     }
 
+    OCS_STATUS_RETURN_ON_ERROR(ota_pipeline_->start());
     OCS_STATUS_RETURN_ON_ERROR(system_pipeline_->start());
 
     return status::StatusCode::OK;
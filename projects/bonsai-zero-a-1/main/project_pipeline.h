@@ -38,10 +38,36 @@
 #include "ocs_system/fanout_suspender.h"
 #include "ocs_system/platform_builder.h"
 
+#include "bonsai_core/oneshot_task.h"
+#include "bonsai_core/tracing_task_scheduler.h"
+#include "bonsai_deadband/deadband_pipeline.h"
+#include "bonsai_diagnostic/boot_profile_pipeline.h"
+#include "bonsai_diagnostic/coredump_pipeline.h"
+#include "bonsai_diagnostic/format_bench_pipeline.h"
+#include "bonsai_diagnostic/heap_monitor_pipeline.h"
+#include "bonsai_diagnostic/log_pipeline.h"
+#include "bonsai_diagnostic/trace_pipeline.h"
+#include "bonsai_event/event_bus_pipeline.h"
+#include "bonsai_http/instrumented_router.h"
+#include "bonsai_http/json_stream_pipeline.h"
+#include "bonsai_mqtt/mqtt_pipeline.h"
+#include "bonsai_net/beacon_pipeline.h"
+#include "bonsai_net/fast_connect_pipeline.h"
+#include "bonsai_net/network_start_task.h"
+#include "bonsai_ota/ota_pipeline.h"
+#include "bonsai_power/power_pipeline.h"
+#include "bonsai_replay/sensor_trace_pipeline.h"
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/sampling_scheduler.h"
+#include "bonsai_sensor/sensor_task_scheduler.h"
+#include "bonsai_sensor/snapshot_formatter.h"
+#include "bonsai_storage/warm_start_pipeline.h"
+#include "bonsai_storage/write_behind_pipeline.h"
+
 namespace ocs {
 namespace bonsai {
 
-class ProjectPipeline : private system::ISuspendHandler, private core::NonCopyable<> {
+class ProjectPipeline : private core::NonCopyable<> {
 public:
     //! Initialize.
     ProjectPipeline();
@@ -50,8 +76,6 @@ public:
     status::StatusCode start();
 
 private:
-    status::StatusCode handle_suspend() override;
-    status::StatusCode handle_resume() override;
 
     static constexpr const char* mdns_config_storage_id_ = "mdns_config";
     static constexpr const char* analog_config_storage_id_ = "analog_config";
@@ -60,18 +84,29 @@ private:
     std::unique_ptr<system::FanoutSuspender> fanout_suspender_;
 
     std::unique_ptr<pipeline::basic::SystemPipeline> system_pipeline_;
+    std::unique_ptr<TracingTaskScheduler> task_scheduler_;
+    std::unique_ptr<SamplingScheduler> sampling_scheduler_;
     std::unique_ptr<pipeline::jsonfmt::DataPipeline> json_data_pipeline_;
 
+    std::unique_ptr<http::IRouter> http_router_;
+    std::unique_ptr<InstrumentedRouter> instrumented_router_;
+    std::unique_ptr<WriteBehindPipeline> write_behind_pipeline_;
+    std::unique_ptr<WarmStartPipeline> warm_start_pipeline_;
+    std::unique_ptr<DeadbandPipeline> deadband_pipeline_;
+
     std::unique_ptr<net::FanoutNetworkHandler> fanout_network_handler_;
 
-    storage::StorageBuilder::IStoragePtr mdns_config_storage_;
     std::unique_ptr<net::MdnsConfig> mdns_config_;
     std::unique_ptr<net::MdnsService> http_mdns_service_;
     std::unique_ptr<net::BasicMdnsServer> mdns_server_;
 
-    std::unique_ptr<http::IRouter> http_router_;
     std::unique_ptr<http::IServer> http_server_;
+    std::unique_ptr<JsonStreamPipeline> json_stream_pipeline_;
     std::unique_ptr<pipeline::httpserver::HttpPipeline> http_pipeline_;
+    std::unique_ptr<EventBusPipeline> event_bus_pipeline_;
+    std::unique_ptr<MqttPipeline> mqtt_pipeline_;
+    std::unique_ptr<BeaconPipeline> beacon_pipeline_;
+    std::unique_ptr<FormatBenchPipeline> format_bench_pipeline_;
     std::unique_ptr<pipeline::httpserver::TimePipeline> time_pipeline_;
 
     std::unique_ptr<pipeline::basic::SelectNetworkPipeline> network_pipeline_;
@@ -79,11 +114,13 @@ private:
     std::unique_ptr<pipeline::httpserver::ApNetworkHandler> ap_network_handler_;
     std::unique_ptr<fmt::json::IFormatter> sta_network_formatter_;
     std::unique_ptr<pipeline::httpserver::StaNetworkHandler> sta_network_handler_;
+    std::unique_ptr<FastConnectPipeline> fast_connect_pipeline_;
+    std::unique_ptr<PowerPipeline> power_pipeline_;
 
     std::unique_ptr<io::adc::IStore> adc_store_;
     std::unique_ptr<io::adc::IConverter> adc_converter_;
+    std::unique_ptr<SensorTracePipeline> sensor_trace_pipeline_;
 
-    storage::StorageBuilder::IStoragePtr analog_config_storage_;
     std::unique_ptr<sensor::AnalogConfigStore> analog_config_store_;
     std::unique_ptr<pipeline::httpserver::AnalogConfigStoreHandler>
         analog_config_store_handler_;
@@ -91,10 +128,31 @@ private:
     static constexpr const char* soil_sensor_id_ = "soil_a0";
 
     std::unique_ptr<sensor::AnalogConfig> soil_sensor_config_;
+    std::unique_ptr<SensorTaskScheduler> soil_sensor_scheduler_;
     std::unique_ptr<sensor::soil::AnalogSensorPipeline> soil_sensor_pipeline_;
     std::unique_ptr<fmt::json::IFormatter> soil_sensor_json_formatter_;
+    std::unique_ptr<SnapshotFormatter> soil_sensor_snapshot_formatter_;
+
+#ifdef CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
+    std::unique_ptr<AdaptiveSampler::ISignal> soil_sensor_signal_;
+    std::unique_ptr<AdaptiveSampler> soil_sensor_sampler_;
+    std::unique_ptr<fmt::json::IFormatter> soil_sensor_sampler_json_formatter_;
+#endif // CONFIG_BONSAI_FIRMWARE_ADAPTIVE_SAMPLING_ENABLE
 
     std::unique_ptr<pipeline::httpserver::WebGuiPipeline> web_gui_pipeline_;
+
+    std::unique_ptr<HeapMonitorPipeline> heap_monitor_pipeline_;
+    std::unique_ptr<CoredumpPipeline> coredump_pipeline_;
+    std::unique_ptr<BootProfilePipeline> boot_profile_pipeline_;
+    std::unique_ptr<TracePipeline> trace_pipeline_;
+    std::unique_ptr<LogPipeline> log_pipeline_;
+    std::unique_ptr<OtaPipeline> ota_pipeline_;
+
+    std::unique_ptr<NetworkStartTask> network_start_task_;
+
+#ifdef CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
+    std::unique_ptr<OneshotTask> network_start_oneshot_task_;
+#endif // CONFIG_BONSAI_FIRMWARE_NETWORK_START_ASYNC
 };
 
 } // namespace bonsai
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "bonsai_core/seqlock.h"
+
+#include "check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const unsigned reader_count = 4;
+const uint32_t write_count = 200000;
+
+// Large enough for the copy to be interrupted by the writer.
+struct Data {
+    uint32_t values[32];
+};
+
+void test_concurrent_read_write() {
+    Seqlock<Data> seqlock;
+
+    std::atomic<bool> done { false };
+    std::atomic<uint32_t> read_count { 0 };
+
+    std::vector<std::thread> readers;
+
+    for (unsigned n = 0; n < reader_count; ++n) {
+        readers.emplace_back([&] {
+            uint32_t prev = 0;
+
+            while (!done) {
+                const Data data = seqlock.read();
+
+                // All fields are written together, so a torn read has different ones.
+                for (const auto value : data.values) {
+                    BONSAI_CHECK(value == data.values[0]);
+                }
+
+                // A reader never goes back in time.
+                BONSAI_CHECK(data.values[0] >= prev);
+                prev = data.values[0];
+
+                ++read_count;
+            }
+        });
+    }
+
+    std::thread writer([&] {
+        Data data;
+
+        for (uint32_t n = 1; n <= write_count; ++n) {
+            for (auto& value : data.values) {
+                value = n;
+            }
+
+            seqlock.write(data);
+        }
+
+        done = true;
+    });
+
+    writer.join();
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    BONSAI_CHECK(seqlock.get_version() == write_count);
+    BONSAI_CHECK(seqlock.read().values[0] == write_count);
+    BONSAI_CHECK(read_count > 0);
+}
+
+} // namespace
+
+} // namespace bonsai
+} // namespace ocs
+
+int main() {
+    ocs::bonsai::test_concurrent_read_write();
+
+    return 0;
+}
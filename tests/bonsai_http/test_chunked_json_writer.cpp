@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdio>
+#include <string>
+
+#include "cJSON.h"
+
+#include "bonsai_http/chunked_json_writer.h"
+
+#include "check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const size_t chunk_size = 256;
+const size_t document_size = 10 * 1024;
+
+class TestChunkWriter : public IChunkWriter {
+public:
+    status::StatusCode write(const char* data, size_t size) override {
+        BONSAI_CHECK(size);
+        BONSAI_CHECK(size <= chunk_size);
+
+        data_.append(data, size);
+        ++count_;
+
+        return status::StatusCode::OK;
+    }
+
+    const std::string& data() const {
+        return data_;
+    }
+
+    size_t count() const {
+        return count_;
+    }
+
+private:
+    std::string data_;
+    size_t count_ { 0 };
+};
+
+std::string print(const cJSON* json) {
+    char* str = cJSON_PrintUnformatted(json);
+    BONSAI_CHECK(str);
+
+    std::string ret(str);
+    cJSON_free(str);
+
+    return ret;
+}
+
+// Telemetry-like document with the escaped strings and the fractional numbers.
+cJSON* make_document() {
+    cJSON* json = cJSON_CreateObject();
+    BONSAI_CHECK(json);
+
+    BONSAI_CHECK(cJSON_AddStringToObject(json, "fw_name", "bonsai-firmware"));
+    BONSAI_CHECK(cJSON_AddNumberToObject(json, "uptime", 123456));
+
+    cJSON* readings = cJSON_AddArrayToObject(json, "readings");
+    BONSAI_CHECK(readings);
+
+    char name[32];
+
+    for (unsigned n = 0; print(json).size() < document_size; ++n) {
+        cJSON* item = cJSON_CreateObject();
+        BONSAI_CHECK(item);
+
+        snprintf(name, sizeof(name), "sensor_%u", n);
+
+        BONSAI_CHECK(cJSON_AddStringToObject(item, "name", name));
+        BONSAI_CHECK(cJSON_AddNumberToObject(item, "raw", n * 37));
+        BONSAI_CHECK(cJSON_AddNumberToObject(item, "value", n * 0.25 - 3.1));
+        BONSAI_CHECK(cJSON_AddBoolToObject(item, "valid", n % 2));
+        BONSAI_CHECK(cJSON_AddStringToObject(item, "note", "\"quoted\"\t\\path\n"));
+
+        cJSON_AddItemToArray(readings, item);
+    }
+
+    return json;
+}
+
+void test_write_large_document() {
+    cJSON* json = make_document();
+
+    const std::string expected = print(json);
+    BONSAI_CHECK(expected.size() >= document_size);
+
+    char buf[chunk_size];
+
+    TestChunkWriter chunk_writer;
+    ChunkedJsonWriter json_writer(chunk_writer, buf, sizeof(buf));
+
+    BONSAI_CHECK(json_writer.write(json) == status::StatusCode::OK);
+
+    BONSAI_CHECK(chunk_writer.data() == expected);
+    BONSAI_CHECK(chunk_writer.count() >= expected.size() / chunk_size);
+
+    cJSON_Delete(json);
+}
+
+void test_write_fields() {
+    cJSON* json = make_document();
+
+    const std::string expected = print(json);
+
+    char buf[chunk_size];
+
+    TestChunkWriter chunk_writer;
+    ChunkedJsonWriter json_writer(chunk_writer, buf, sizeof(buf));
+
+    BONSAI_CHECK(json_writer.write_fields(json) == status::StatusCode::OK);
+
+    // Same as the whole object, without the enclosing braces.
+    BONSAI_CHECK(chunk_writer.data() == expected.substr(1, expected.size() - 2));
+
+    cJSON_Delete(json);
+}
+
+} // namespace
+
+} // namespace bonsai
+} // namespace ocs
+
+int main() {
+    ocs::bonsai::test_write_large_document();
+    ocs::bonsai::test_write_fields();
+
+    return 0;
+}
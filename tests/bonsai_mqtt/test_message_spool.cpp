@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstring>
+
+#include "bonsai_mqtt/message_spool.h"
+
+#include "check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+// Header and 7 bytes of payload.
+const size_t record_size = 10;
+
+void push(MessageSpool& spool, const char* data) {
+    BONSAI_CHECK(strlen(data) + 3 == record_size);
+    BONSAI_CHECK(spool.push(0, data, strlen(data)));
+}
+
+void check_front(const MessageSpool& spool, const char* data) {
+    char buf[16];
+    uint8_t topic = 0;
+
+    const size_t size = spool.front(topic, buf, sizeof(buf));
+    BONSAI_CHECK(size == strlen(data));
+    BONSAI_CHECK(memcmp(buf, data, size) == 0);
+}
+
+void test_full_drops_oldest() {
+    MessageSpool spool(record_size * 2);
+
+    push(spool, "message");
+    push(spool, "second_");
+    push(spool, "third__");
+
+    BONSAI_CHECK(spool.get_count() == 2);
+    BONSAI_CHECK(spool.get_drop_count() == 1);
+
+    check_front(spool, "second_");
+}
+
+void test_full_keeps_pinned() {
+    MessageSpool spool(record_size * 2);
+
+    push(spool, "message");
+    push(spool, "second_");
+
+    spool.pin_front(true);
+
+    push(spool, "third__");
+
+    BONSAI_CHECK(spool.get_count() == 2);
+    BONSAI_CHECK(spool.get_drop_count() == 1);
+
+    check_front(spool, "message");
+
+    // Acknowledged, the next message isn't pinned.
+    spool.pop();
+    check_front(spool, "second_");
+
+    push(spool, "fourth_");
+    push(spool, "fifth__");
+
+    BONSAI_CHECK(spool.get_count() == 2);
+    BONSAI_CHECK(spool.get_drop_count() == 2);
+
+    check_front(spool, "fourth_");
+}
+
+} // namespace
+
+} // namespace bonsai
+} // namespace ocs
+
+int main() {
+    ocs::bonsai::test_full_drops_oldest();
+    ocs::bonsai::test_full_keeps_pinned();
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <vector>
+
+#include "bonsai_replay/replay_adc_store.h"
+#include "bonsai_replay/sensor_trace.h"
+#include "bonsai_replay/sensor_trace_reader.h"
+#include "bonsai_replay/sensor_trace_replayer.h"
+#include "bonsai_replay/virtual_clock.h"
+
+#include "check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+const core::Time second = 1000 * 1000;
+
+const io::adc::Channel soil_channel = 6;
+const io::adc::Channel ldr_channel = 7;
+
+class TraceBuilder {
+public:
+    TraceBuilder()
+        : data_(SensorTrace::header_size) {
+        SensorTrace::write_header(data_.data());
+    }
+
+    void add(core::Time timestamp,
+             io::adc::Channel channel,
+             int32_t value,
+             status::StatusCode code = status::StatusCode::OK) {
+        const size_t size = data_.size();
+        data_.resize(size + SensorTrace::record_size);
+
+        SensorTrace::encode(
+            SensorTrace::Record {
+                .timestamp = timestamp,
+                .value = value,
+                .count = 8,
+                .channel = static_cast<uint8_t>(channel),
+                .code = code,
+            },
+            data_.data() + size);
+    }
+
+    const std::vector<uint8_t>& get() const {
+        return data_;
+    }
+
+private:
+    std::vector<uint8_t> data_;
+};
+
+class TestTask : public scheduler::ITask {
+public:
+    TestTask(core::IClock& clock, io::adc::IReader& reader)
+        : clock_(clock)
+        , reader_(reader) {
+    }
+
+    status::StatusCode run() override {
+        const auto result = reader_.read();
+
+        times_.push_back(clock_.now());
+        values_.push_back(result.code == status::StatusCode::OK ? result.value : -1);
+
+        return result.code;
+    }
+
+    std::vector<core::Time> times_;
+    std::vector<int> values_;
+
+private:
+    core::IClock& clock_;
+    io::adc::IReader& reader_;
+};
+
+void test_replay_readings() {
+    TraceBuilder builder;
+
+    builder.add(100 * second, soil_channel, 1500);
+    builder.add(100 * second, ldr_channel, 40);
+    builder.add(110 * second, soil_channel, 1600);
+    builder.add(120 * second, soil_channel, 0, status::StatusCode::Error);
+    builder.add(125 * second, ldr_channel, 50);
+    builder.add(130 * second, soil_channel, 1700);
+
+    SensorTraceReader trace(builder.get().data(), builder.get().size());
+    BONSAI_CHECK(trace.is_valid());
+    BONSAI_CHECK(trace.get_count() == 6);
+
+    VirtualClock clock;
+    ReplayAdcStore store(clock, trace);
+
+    io::adc::IReader* soil_reader = store.add(soil_channel);
+    BONSAI_CHECK(soil_reader);
+
+    io::adc::IReader* ldr_reader = store.add(ldr_channel);
+    BONSAI_CHECK(ldr_reader);
+
+    TestTask soil_task(clock, *soil_reader);
+    TestTask ldr_task(clock, *ldr_reader);
+
+    SensorTraceReplayer replayer(clock, trace);
+    replayer.add(soil_task, 10 * second);
+    replayer.add(ldr_task, 15 * second);
+
+    const auto stats = replayer.run();
+
+    BONSAI_CHECK(stats.duration == 30 * second);
+    BONSAI_CHECK(stats.run_count == 4 + 3);
+    BONSAI_CHECK(stats.error_count == 1);
+
+    // Each task sees the last record of its channel at its own deadlines.
+    const std::vector<core::Time> soil_times = { 100 * second, 110 * second,
+                                                 120 * second, 130 * second };
+    const std::vector<int> soil_values = { 1500, 1600, -1, 1700 };
+
+    BONSAI_CHECK(soil_task.times_ == soil_times);
+    BONSAI_CHECK(soil_task.values_ == soil_values);
+
+    const std::vector<core::Time> ldr_times = { 100 * second, 115 * second,
+                                                130 * second };
+    const std::vector<int> ldr_values = { 40, 40, 50 };
+
+    BONSAI_CHECK(ldr_task.times_ == ldr_times);
+    BONSAI_CHECK(ldr_task.values_ == ldr_values);
+}
+
+void test_replay_before_first_record() {
+    TraceBuilder builder;
+
+    builder.add(50 * second, ldr_channel, 10);
+    builder.add(60 * second, soil_channel, 2000);
+
+    SensorTraceReader trace(builder.get().data(), builder.get().size());
+
+    VirtualClock clock;
+    ReplayAdcStore store(clock, trace);
+
+    TestTask soil_task(clock, *store.add(soil_channel));
+
+    SensorTraceReplayer replayer(clock, trace);
+    replayer.add(soil_task, 5 * second);
+
+    const auto stats = replayer.run();
+
+    BONSAI_CHECK(stats.run_count == 3);
+    BONSAI_CHECK(stats.error_count == 2);
+
+    const std::vector<int> soil_values = { -1, -1, 2000 };
+    BONSAI_CHECK(soil_task.values_ == soil_values);
+}
+
+void test_invalid_trace() {
+    const uint8_t data[] = { 'B', 'A', 'D', '!', 1, 16, 0, 0 };
+
+    SensorTraceReader trace(data, sizeof(data));
+    BONSAI_CHECK(!trace.is_valid());
+}
+
+} // namespace
+
+} // namespace bonsai
+} // namespace ocs
+
+int main() {
+    ocs::bonsai::test_replay_readings();
+    ocs::bonsai::test_replay_before_first_record();
+    ocs::bonsai::test_invalid_trace();
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bonsai_sensor/adaptive_sampler.h"
+#include "bonsai_sensor/change_detector.h"
+
+#include "check.h"
+
+namespace ocs {
+namespace bonsai {
+
+namespace {
+
+class TestClock : public core::IClock {
+public:
+    core::Time now() override {
+        return now_;
+    }
+
+    core::Time now_ { 0 };
+};
+
+class TestSignal : public AdaptiveSampler::ISignal {
+public:
+    bool changed(core::Time) override {
+        return changed_;
+    }
+
+    bool changed_ { false };
+};
+
+const core::Time min_interval = 10;
+const core::Time max_interval = 80;
+
+void read(TestClock& clock, AdaptiveSampler& sampler, core::Time now) {
+    clock.now_ = now;
+    BONSAI_CHECK(sampler.is_due());
+    sampler.handle_read(status::StatusCode::OK);
+}
+
+void test_sampler_backoff() {
+    TestClock clock;
+    TestSignal signal;
+    AdaptiveSampler sampler(clock, signal,
+                            AdaptiveSampler::Params {
+                                .min_interval = min_interval,
+                                .max_interval = max_interval,
+                            });
+
+    read(clock, sampler, 0);
+    BONSAI_CHECK(sampler.get_interval() == 20);
+
+    read(clock, sampler, 20);
+    BONSAI_CHECK(sampler.get_interval() == 40);
+
+    read(clock, sampler, 60);
+    BONSAI_CHECK(sampler.get_interval() == 80);
+
+    read(clock, sampler, 140);
+    BONSAI_CHECK(sampler.get_interval() == max_interval);
+
+    // Reading is skipped until the effective interval has elapsed.
+    clock.now_ = 150;
+    BONSAI_CHECK(!sampler.is_due());
+
+    signal.changed_ = true;
+    read(clock, sampler, 220);
+    BONSAI_CHECK(sampler.get_interval() == min_interval);
+
+    sampler.handle_read(status::StatusCode::Error);
+    BONSAI_CHECK(sampler.get_interval() == min_interval);
+}
+
+void test_sampler_early_fire() {
+    TestClock clock;
+    TestSignal signal;
+    AdaptiveSampler sampler(clock, signal,
+                            AdaptiveSampler::Params {
+                                .min_interval = min_interval,
+                                .max_interval = max_interval,
+                            });
+
+    read(clock, sampler, 0);
+
+    // The task fired slightly before the deadline, the reading is still due.
+    read(clock, sampler, 19);
+    BONSAI_CHECK(sampler.get_interval() == 40);
+
+    clock.now_ = 19 + 40 - min_interval / 2 - 1;
+    BONSAI_CHECK(!sampler.is_due());
+
+    clock.now_ = 19 + 40 - min_interval / 2;
+    BONSAI_CHECK(sampler.is_due());
+}
+
+void test_detector_threshold() {
+    ChangeDetector detector(1, 0);
+
+    BONSAI_CHECK(detector.update(20, 0));
+    BONSAI_CHECK(!detector.update(20.5, 10));
+
+    // Slow drift is accumulated against the reference value.
+    BONSAI_CHECK(detector.update(21, 20));
+    BONSAI_CHECK(!detector.update(21.9, 30));
+}
+
+void test_detector_rate() {
+    ChangeDetector detector(1, 60);
+
+    BONSAI_CHECK(detector.update(20, 0));
+
+    // 0.1 per 10s is 0.6 per window, stable.
+    BONSAI_CHECK(!detector.update(20.1, 10));
+
+    // 0.5 per 10s is 3 per window, changing fast.
+    BONSAI_CHECK(detector.update(20.6, 20));
+    BONSAI_CHECK(!detector.update(20.6, 30));
+}
+
+} // namespace
+
+} // namespace bonsai
+} // namespace ocs
+
+int main() {
+    ocs::bonsai::test_sampler_backoff();
+    ocs::bonsai::test_sampler_early_fire();
+    ocs::bonsai::test_detector_threshold();
+    ocs::bonsai::test_detector_rate();
+
+    return 0;
+}
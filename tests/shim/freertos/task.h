@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025, Open Control Systems authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <thread>
+
+#include "freertos/FreeRTOS.h"
+
+//! Host replacement for the FreeRTOS task API used by the tested components.
+inline void vTaskDelay(unsigned ticks) {
+    (void)ticks;
+    std::this_thread::yield();
+}
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Receive, verify and decode the bonsai UDP telemetry beacons.
+
+The frame format is described in components/bonsai_net/beacon_frame.h. Field names
+are resolved by the schema identifier, the schema is fetched from the sender via
+GET /api/v1/beacon/schema.
+"""
+
+import argparse
+import json
+import socket
+import struct
+import sys
+import urllib.request
+import zlib
+
+MAGIC = b"BB"
+VERSION = 1
+HEADER = struct.Struct("<2sBB6sIII")
+
+
+class FrameError(Exception):
+    pass
+
+
+def decode(data):
+    if len(data) < HEADER.size + 4:
+        raise FrameError(f"frame too short: size={len(data)}")
+
+    crc = struct.unpack_from("<I", data, len(data) - 4)[0]
+    if zlib.crc32(data[:-4]) != crc:
+        raise FrameError("CRC mismatch")
+
+    magic, version, field_count, device_id, seq, timestamp, schema = \
+        HEADER.unpack_from(data)
+
+    if magic != MAGIC:
+        raise FrameError(f"invalid magic: {magic!r}")
+    if version != VERSION:
+        raise FrameError(f"unsupported version: {version}")
+
+    bitmap_size = (field_count + 7) // 8
+    bitmap = data[HEADER.size:HEADER.size + bitmap_size]
+
+    indices = [n for n in range(field_count) if bitmap[n // 8] & (1 << (n % 8))]
+
+    values_offset = HEADER.size + bitmap_size
+    if values_offset + len(indices) * 4 + 4 != len(data):
+        raise FrameError(f"size mismatch: fields={len(indices)} size={len(data)}")
+
+    values = struct.unpack_from(f"<{len(indices)}f", data, values_offset)
+
+    return {
+        "device": device_id.hex(":"),
+        "seq": seq,
+        "ts": timestamp,
+        "schema": schema,
+        "fields": dict(zip(indices, values)),
+    }
+
+
+def fetch_schema(host, port, timeout):
+    url = f"http://{host}:{port}/api/v1/beacon/schema"
+    with urllib.request.urlopen(url, timeout=timeout) as resp:
+        schema = json.load(resp)
+
+    return int(schema["schema"]), schema["fields"]
+
+
+def open_socket(group, port):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", port))
+
+    if socket.inet_aton(group)[0] in range(224, 240):
+        mreq = struct.pack("4s4s", socket.inet_aton(group), socket.inet_aton("0.0.0.0"))
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+
+    return sock
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--group", default="239.255.66.1",
+                        help="multicast group, ignored for the broadcast beacons")
+    parser.add_argument("--port", type=int, default=4210, help="UDP port")
+    parser.add_argument("--schema-port", type=int, default=80,
+                        help="HTTP server port, 0 to disable schema fetching")
+    parser.add_argument("--json", action="store_true", help="print frames as JSON")
+    args = parser.parse_args()
+
+    sock = open_socket(args.group, args.port)
+
+    schemas = {}
+    last_seq = {}
+
+    while True:
+        data, (host, _) = sock.recvfrom(2048)
+
+        try:
+            frame = decode(data)
+        except FrameError as e:
+            print(f"{host}: invalid frame: {e}", file=sys.stderr)
+            continue
+
+        device = frame["device"]
+
+        prev_seq = last_seq.get(device)
+        if prev_seq is not None and frame["seq"] != prev_seq + 1:
+            if frame["seq"] <= prev_seq:
+                print(f"{device}: sequence restarted: {prev_seq} -> {frame['seq']}",
+                      file=sys.stderr)
+            else:
+                print(f"{device}: lost {frame['seq'] - prev_seq - 1} frame(s)",
+                      file=sys.stderr)
+        last_seq[device] = frame["seq"]
+
+        key = (device, frame["schema"])
+        if key not in schemas and args.schema_port:
+            try:
+                schema_id, names = fetch_schema(host, args.schema_port, timeout=5)
+                if schema_id == frame["schema"]:
+                    schemas[key] = names
+            except Exception as e:
+                print(f"{host}: failed to fetch schema: {e}", file=sys.stderr)
+
+        names = schemas.get(key, [])
+        fields = {
+            (names[n] if n < len(names) else f"field_{n}"): value
+            for n, value in frame["fields"].items()
+        }
+
+        if args.json:
+            print(json.dumps({**frame, "fields": fields}), flush=True)
+        else:
+            values = " ".join(f"{k}={v:g}" for k, v in fields.items())
+            print(f"{host} {device} seq={frame['seq']} ts={frame['ts']} {values}",
+                  flush=True)
+
+
+if __name__ == "__main__":
+    main()
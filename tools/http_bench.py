@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Load the device HTTP API and report throughput, latency and heap usage.
+
+Each scenario is run for a fixed duration by concurrent clients, each client sends
+requests back-to-back over a keep-alive connection:
+  - telemetry: GET /api/v1/telemetry.
+  - registration: GET /api/v1/registration.
+  - web_gui: GET / and the scripts and styles it references.
+  - config: GET of the configuration endpoints.
+  - stream: GET /api/v1/telemetry and /api/v1/registration, interleaved.
+
+The heap is sampled via GET /api/v1/diagnostic/heap while the scenario runs.
+"""
+
+import argparse
+import http.client
+import json
+import re
+import statistics
+import sys
+import threading
+import time
+import urllib.request
+
+SCENARIOS = ("telemetry", "registration", "web_gui", "config", "stream")
+
+CONFIG_PATHS = ("/api/v1/config/deadband", "/api/v1/config/power")
+STREAM_PATHS = ("/api/v1/telemetry", "/api/v1/registration")
+
+
+def percentile(values, p):
+    values = sorted(values)
+    index = min(len(values) - 1, max(0, round(p / 100 * len(values)) - 1))
+    return values[index]
+
+
+def fetch(host, port, path, timeout):
+    url = f"http://{host}:{port}{path}"
+    with urllib.request.urlopen(url, timeout=timeout) as resp:
+        return resp.read()
+
+
+def discover_assets(host, port, timeout):
+    """Return the paths of the web GUI page and the assets it references."""
+    page = fetch(host, port, "/", timeout).decode("utf-8", errors="replace")
+    assets = re.findall(r'(?:src|href)="(/[^"]+\.(?:js|css|svg|ico|png))"', page)
+    return ["/"] + sorted(set(assets))
+
+
+def read_heap(args):
+    """Return (free, min_free) of the default heap, or None if unavailable."""
+    try:
+        data = json.loads(fetch(args.host, args.port,
+                                "/api/v1/diagnostic/heap", args.timeout))
+        return data["heap"]["free"], data["heap"]["min_free"]
+    except Exception:
+        return None
+
+
+class Worker(threading.Thread):
+    def __init__(self, host, port, paths, deadline, timeout, index):
+        super().__init__(daemon=True)
+        self.host = host
+        self.port = port
+        self.paths = paths
+        self.deadline = deadline
+        self.timeout = timeout
+        self.index = index
+        self.latencies = []
+        self.failed = 0
+        self.bytes = 0
+
+    def run(self):
+        conn = None
+        n = self.index
+
+        while time.monotonic() < self.deadline:
+            path = self.paths[n % len(self.paths)]
+            n += 1
+
+            if conn is None:
+                conn = http.client.HTTPConnection(self.host, self.port,
+                                                  timeout=self.timeout)
+
+            start = time.monotonic()
+            try:
+                conn.request("GET", path)
+                resp = conn.getresponse()
+                body = resp.read()
+                if resp.status != 200:
+                    raise RuntimeError(f"status={resp.status}")
+                if resp.will_close:
+                    conn.close()
+                    conn = None
+            except Exception:
+                self.failed += 1
+                if conn is not None:
+                    conn.close()
+                    conn = None
+                continue
+
+            self.latencies.append(time.monotonic() - start)
+            self.bytes += len(body)
+
+        if conn is not None:
+            conn.close()
+
+
+class HeapSampler(threading.Thread):
+    def __init__(self, args, stop):
+        super().__init__(daemon=True)
+        self.args = args
+        self.stop = stop
+        self.min_free = None
+
+    def run(self):
+        while not self.stop.wait(self.args.heap_interval):
+            heap = read_heap(self.args)
+            if heap is None:
+                continue
+            if self.min_free is None or heap[0] < self.min_free:
+                self.min_free = heap[0]
+
+
+def run_scenario(args, name, port, paths):
+    print(f"running {name}: concurrency={args.concurrency} duration={args.duration}s",
+          file=sys.stderr)
+
+    heap_before = read_heap(args)
+
+    stop = threading.Event()
+    sampler = HeapSampler(args, stop)
+    sampler.start()
+
+    start = time.monotonic()
+    deadline = start + args.duration
+    workers = [Worker(args.host, port, paths, deadline, args.timeout, n)
+               for n in range(args.concurrency)]
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+    elapsed = time.monotonic() - start
+
+    stop.set()
+    sampler.join()
+
+    heap_after = read_heap(args)
+
+    latencies = [v * 1000 for w in workers for v in w.latencies]
+    failed = sum(w.failed for w in workers)
+
+    result = {
+        "scenario": name,
+        "port": port,
+        "paths": paths,
+        "concurrency": args.concurrency,
+        "duration_s": round(elapsed, 2),
+        "requests": len(latencies),
+        "failed": failed,
+        "rps": round(len(latencies) / elapsed, 2),
+        "bytes_per_s": round(sum(w.bytes for w in workers) / elapsed),
+        "heap_free_before": heap_before[0] if heap_before else None,
+        "heap_free_min": sampler.min_free,
+        "heap_min_free": heap_after[1] if heap_after else None,
+    }
+
+    if latencies:
+        result.update({
+            "mean_ms": round(statistics.mean(latencies), 1),
+            "p50_ms": round(percentile(latencies, 50), 1),
+            "p90_ms": round(percentile(latencies, 90), 1),
+            "p99_ms": round(percentile(latencies, 99), 1),
+            "max_ms": round(max(latencies), 1),
+        })
+
+    return result
+
+
+def format_value(value):
+    return "-" if value is None else str(value)
+
+
+def print_table(results):
+    columns = ("scenario", "rps", "p50_ms", "p90_ms", "p99_ms", "max_ms", "failed",
+               "heap_free_min", "heap_min_free")
+    widths = [max(len(c), *(len(format_value(r.get(c))) for r in results))
+              for c in columns]
+
+    print("  ".join(c.rjust(w) for c, w in zip(columns, widths)))
+    for result in results:
+        print("  ".join(format_value(result.get(c)).rjust(w)
+                        for c, w in zip(columns, widths)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device IP address or hostname")
+    parser.add_argument("--port", type=int, default=80, help="HTTP server port")
+    parser.add_argument("--scenarios", default=",".join(SCENARIOS),
+                        help="comma-separated scenarios to run")
+    parser.add_argument("--concurrency", type=int, default=4,
+                        help="number of concurrent clients")
+    parser.add_argument("--duration", type=float, default=20.0,
+                        help="duration of each scenario, seconds")
+    parser.add_argument("--pause", type=float, default=5.0,
+                        help="pause between scenarios, seconds")
+    parser.add_argument("--heap-interval", type=float, default=1.0,
+                        help="heap sampling interval, seconds")
+    parser.add_argument("--timeout", type=float, default=10.0, help="request timeout")
+    parser.add_argument("--json", action="store_true", help="print results as JSON")
+    parser.add_argument("--output", help="append results as a JSON line to the file")
+    args = parser.parse_args()
+
+    scenarios = [s.strip() for s in args.scenarios.split(",") if s.strip()]
+    for scenario in scenarios:
+        if scenario not in SCENARIOS:
+            parser.error(f"unknown scenario: {scenario}")
+
+    results = []
+
+    for n, scenario in enumerate(scenarios):
+        if n:
+            time.sleep(args.pause)
+
+        if scenario == "telemetry":
+            port, paths = args.port, ["/api/v1/telemetry"]
+        elif scenario == "registration":
+            port, paths = args.port, ["/api/v1/registration"]
+        elif scenario == "web_gui":
+            port, paths = args.port, discover_assets(args.host, args.port, args.timeout)
+        elif scenario == "config":
+            port, paths = args.port, list(CONFIG_PATHS)
+        else:
+            port, paths = args.port, list(STREAM_PATHS)
+
+        results.append(run_scenario(args, scenario, port, paths))
+
+    report = {
+        "host": args.host,
+        "timestamp": int(time.time()),
+        "results": results,
+    }
+
+    if args.output:
+        with open(args.output, "a") as f:
+            f.write(json.dumps(report) + "\n")
+
+    if args.json:
+        print(json.dumps(report, indent=2))
+    else:
+        print_table(results)
+
+    if any(r["failed"] for r in results):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
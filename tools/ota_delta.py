@@ -0,0 +1,348 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Make and apply the delta patches between two firmware images.
+
+The patch is applied by the device while it's uploaded via POST /api/v1/ota/delta,
+see tools/ota_upload.py --delta. The source image should be the
+exact image the device is running, the format is described in DeltaPatcher.
+
+Only the changed bytes are sent: the matching regions of the source image are encoded
+as byte-wise differences, which are mostly zero even if the code was shifted, and the
+zero runs are run-length encoded. The new regions are sent as is.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+
+MAGIC = b"BDLT"
+VERSION = 1
+HEADER = struct.Struct("<4sB3xII32s32s")
+
+OP_END = 0
+OP_SEEK = 1
+OP_DIFF = 2
+OP_EXTRA = 3
+
+# Length of the exact match which starts the diff region.
+SEED_SIZE = 16
+
+# Source positions are indexed with this stride to save memory and time.
+SEED_STRIDE = 4
+
+# Zero run shorter than this is cheaper to keep in the literals.
+MIN_ZERO_RUN = 3
+
+# Stop extending the diff region if the similarity didn't improve for this long.
+MAX_EXTEND_LOOKAHEAD = 256
+
+
+class PatchError(Exception):
+    pass
+
+
+def write_varint(out, value):
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise PatchError("truncated varint")
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def zigzag(value):
+    return value * 2 if value >= 0 else -value * 2 - 1
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def extend_forward(source, src, target, dst):
+    """Return the length of the region in which the source and the target match in
+    more than half of the bytes."""
+    limit = min(len(source) - src, len(target) - dst)
+
+    score = 0
+    best_score = 0
+    best_len = 0
+
+    for k in range(limit):
+        if source[src + k] == target[dst + k]:
+            score += 1
+
+        if score * 2 - (k + 1) > best_score * 2 - best_len:
+            best_score = score
+            best_len = k + 1
+        elif k + 1 - best_len > MAX_EXTEND_LOOKAHEAD:
+            break
+
+    return best_len
+
+
+def encode_diff(out, source, src, target, dst, length):
+    diff = bytes((target[dst + k] - source[src + k]) & 0xff for k in range(length))
+
+    out.append(OP_DIFF)
+    write_varint(out, length)
+
+    pos = 0
+    while pos < length:
+        zeros = pos
+        while zeros < length and diff[zeros] == 0:
+            zeros += 1
+        write_varint(out, zeros - pos)
+        pos = zeros
+
+        if pos == length:
+            break
+
+        end = pos
+        while end < length:
+            run = end
+            while run < length and diff[run] == 0 and run - end < MIN_ZERO_RUN:
+                run += 1
+            if run - end >= MIN_ZERO_RUN or (run == length and run > end):
+                break
+            end = run + 1 if run == end else run
+
+        write_varint(out, end - pos)
+        out += diff[pos:end]
+        pos = end
+
+
+def encode_extra(out, data):
+    if data:
+        out.append(OP_EXTRA)
+        write_varint(out, len(data))
+        out += data
+
+
+def make_patch(source, target):
+    index = {}
+    for pos in range(0, len(source) - SEED_SIZE + 1, SEED_STRIDE):
+        index.setdefault(source[pos:pos + SEED_SIZE], pos)
+
+    out = bytearray(HEADER.pack(MAGIC, VERSION, len(source), len(target),
+                                hashlib.sha256(source).digest(),
+                                hashlib.sha256(target).digest()))
+
+    extra = bytearray()
+    src_pos = 0
+    dst = 0
+
+    while dst < len(target):
+        seed = target[dst:dst + SEED_SIZE]
+
+        if len(seed) < SEED_SIZE:
+            match = None
+        elif source[src_pos:src_pos + SEED_SIZE] == seed:
+            match = src_pos
+        else:
+            match = index.get(seed)
+
+        if match is None:
+            extra.append(target[dst])
+            dst += 1
+            continue
+
+        # The exact seed could be found a few bytes late because of the stride.
+        while extra and match > 0 and source[match - 1] == extra[-1]:
+            extra.pop()
+            match -= 1
+            dst -= 1
+
+        length = extend_forward(source, match, target, dst)
+
+        encode_extra(out, extra)
+        extra = bytearray()
+
+        if match != src_pos:
+            out.append(OP_SEEK)
+            write_varint(out, zigzag(match - src_pos))
+
+        encode_diff(out, source, match, target, dst, length)
+
+        src_pos = match + length
+        dst += length
+
+    encode_extra(out, extra)
+    out.append(OP_END)
+
+    return bytes(out)
+
+
+def parse_header(patch):
+    if len(patch) < HEADER.size:
+        raise PatchError("patch is too short")
+
+    magic, version, source_size, target_size, source_sha256, target_sha256 = \
+        HEADER.unpack_from(patch)
+    if magic != MAGIC:
+        raise PatchError("invalid magic")
+    if version != VERSION:
+        raise PatchError(f"unsupported version {version}")
+
+    return source_size, target_size, source_sha256, target_sha256
+
+
+def apply_patch(source, patch):
+    source_size, target_size, source_sha256, target_sha256 = parse_header(patch)
+
+    if len(source) < source_size \
+            or hashlib.sha256(source[:source_size]).digest() != source_sha256:
+        raise PatchError("patch is made for another source image")
+
+    source = source[:source_size]
+    target = bytearray()
+    src_pos = 0
+    pos = HEADER.size
+
+    while True:
+        if pos >= len(patch):
+            raise PatchError("truncated patch")
+
+        op = patch[pos]
+        pos += 1
+
+        if op == OP_END:
+            break
+
+        if op == OP_SEEK:
+            delta, pos = read_varint(patch, pos)
+            src_pos += unzigzag(delta)
+            if not 0 <= src_pos <= len(source):
+                raise PatchError("seek outside of source")
+        elif op == OP_DIFF:
+            length, pos = read_varint(patch, pos)
+            if src_pos + length > len(source):
+                raise PatchError("diff exceeds source")
+
+            end = src_pos + length
+            while src_pos < end:
+                zeros, pos = read_varint(patch, pos)
+                target += source[src_pos:src_pos + zeros]
+                src_pos += zeros
+                if src_pos == end:
+                    break
+
+                count, pos = read_varint(patch, pos)
+                if src_pos + count > end or (not count and not zeros):
+                    raise PatchError("invalid diff run")
+
+                target += bytes((source[src_pos + k] + patch[pos + k]) & 0xff
+                                for k in range(count))
+                src_pos += count
+                pos += count
+        elif op == OP_EXTRA:
+            length, pos = read_varint(patch, pos)
+            target += patch[pos:pos + length]
+            pos += length
+        else:
+            raise PatchError(f"invalid opcode {op}")
+
+    if pos != len(patch):
+        raise PatchError("data after end of patch")
+
+    if len(target) != target_size or hashlib.sha256(target).digest() != target_sha256:
+        raise PatchError("reconstructed image doesn't match")
+
+    return bytes(target)
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def cmd_make(args):
+    source = read_file(args.source)
+    target = read_file(args.target)
+
+    patch = make_patch(source, target)
+
+    # Never ship a patch which doesn't reproduce the target.
+    apply_patch(source, patch)
+
+    with open(args.output, "wb") as f:
+        f.write(patch)
+
+    print(f"patch: {len(patch)} bytes, {len(patch) * 100 / len(target):.1f}% "
+          f"of the {len(target)} bytes image", file=sys.stderr)
+    return 0
+
+
+def cmd_apply(args):
+    target = apply_patch(read_file(args.source), read_file(args.patch))
+
+    with open(args.output, "wb") as f:
+        f.write(target)
+
+    print(f"{len(target)} bytes written to {args.output}", file=sys.stderr)
+    return 0
+
+
+def cmd_info(args):
+    source_size, target_size, source_sha256, target_sha256 = \
+        parse_header(read_file(args.patch))
+
+    print(f"source: size={source_size} sha256={source_sha256.hex()}")
+    print(f"target: size={target_size} sha256={target_sha256.hex()}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    make_parser = commands.add_parser("make", help="make the patch")
+    make_parser.add_argument("source", help="image the device is running")
+    make_parser.add_argument("target", help="new image")
+    make_parser.add_argument("--output", required=True, help="patch file to write")
+
+    apply_parser = commands.add_parser("apply", help="apply the patch on the host")
+    apply_parser.add_argument("source", help="source image")
+    apply_parser.add_argument("patch", help="patch file")
+    apply_parser.add_argument("--output", required=True, help="image file to write")
+
+    info_parser = commands.add_parser("info", help="print the patch header")
+    info_parser.add_argument("patch", help="patch file")
+
+    args = parser.parse_args()
+
+    try:
+        if args.command == "make":
+            return cmd_make(args)
+        if args.command == "apply":
+            return cmd_apply(args)
+        return cmd_info(args)
+    except (OSError, PatchError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
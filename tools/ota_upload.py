@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Upload the firmware image to the device over HTTP.
+
+The image is sent via POST /api/v1/ota in parts. If a part fails, e.g. the Wi-Fi
+connection drops, the number of bytes written by the device is requested via
+GET /api/v1/ota and the upload is continued from there.
+
+With --delta, the file is the patch made by tools/ota_delta.py, it's sent via
+POST /api/v1/ota/delta and applied by the device to the running firmware.
+
+With --web-gui, the file is the web GUI partition image, e.g. build/web_gui.bin, it's
+sent via POST /api/v1/ota/web_gui and applied by the device on the next boot. The
+trailing erased bytes of the image aren't sent, since the device erases the partition
+before the image is written.
+
+Each request is authorized with the access token set by CONFIG_BONSAI_FIRMWARE_OTA_TOKEN,
+passed via --token or the BONSAI_OTA_TOKEN environment variable.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import sys
+import time
+import urllib.error
+import urllib.request
+
+
+class OtaError(Exception):
+    pass
+
+
+def auth_headers(args):
+    return {"Authorization": f"Bearer {args.token}"}
+
+
+def get_state(args):
+    req = urllib.request.Request(f"http://{args.host}:{args.port}/api/v1/ota",
+                                 headers=auth_headers(args))
+    with urllib.request.urlopen(req, timeout=args.timeout) as resp:
+        return json.loads(resp.read())
+
+
+def get_progress(args, state):
+    """Return the state, the size and the number of written bytes of the upload."""
+    if args.web_gui:
+        return (state.get("web_gui_state", "idle"), state.get("web_gui_size"),
+                state.get("web_gui_written", 0))
+    if args.delta:
+        return state["state"], state.get("patch_size"), state.get("patch_written", 0)
+    return state["state"], state["size"], state["written"]
+
+
+def can_resume(args, state, size):
+    upload_state, upload_size, _ = get_progress(args, state)
+
+    if upload_state in ("failed", "ready") or upload_size != size:
+        return False
+    # The patch header is received before the image update is started.
+    return args.delta or upload_state == "receiving"
+
+
+def post_part(args, image, sha256, offset, reboot):
+    part = image[offset:offset + args.part_size]
+
+    if args.delta:
+        path = "/api/v1/ota/delta"
+        query = f"size={len(image)}&offset={offset}"
+    else:
+        path = "/api/v1/ota/web_gui" if args.web_gui else "/api/v1/ota"
+        query = f"size={len(image)}&sha256={sha256}&offset={offset}"
+    if reboot:
+        query += "&reboot=1"
+
+    req = urllib.request.Request(
+        f"http://{args.host}:{args.port}{path}?{query}", data=part, method="POST",
+        headers={"Content-Type": "application/octet-stream", **auth_headers(args)})
+
+    with urllib.request.urlopen(req, timeout=args.timeout) as resp:
+        return json.loads(resp.read())
+
+
+def upload(args, image):
+    sha256 = hashlib.sha256(image).hexdigest()
+    offset = 0
+    failures = 0
+
+    if args.resume:
+        state = get_state(args)
+        if can_resume(args, state, len(image)):
+            offset = get_progress(args, state)[2]
+            print(f"resuming from {offset}", file=sys.stderr)
+
+    while True:
+        last = offset + args.part_size >= len(image)
+
+        try:
+            state = post_part(args, image, sha256, offset, last and args.reboot)
+        except urllib.error.HTTPError as e:
+            raise OtaError(f"{e.code} {e.read().decode(errors='replace')}")
+        except OSError as e:
+            failures += 1
+            if failures > args.retries:
+                raise OtaError(f"too many failures, last one: {e}")
+
+            print(f"failed to upload part at {offset}: {e}, retrying", file=sys.stderr)
+            time.sleep(args.retry_delay)
+
+            try:
+                state = get_state(args)
+            except OSError as e:
+                print(f"failed to get update state: {e}", file=sys.stderr)
+                continue
+
+            if not can_resume(args, state, len(image)):
+                raise OtaError(
+                    f"update can't be continued, state={get_progress(args, state)[0]}")
+
+            offset = get_progress(args, state)[2]
+            continue
+
+        failures = 0
+        upload_state, _, offset = get_progress(args, state)
+
+        print(f"{offset}/{len(image)} bytes written", file=sys.stderr)
+
+        if upload_state == "ready":
+            return state
+        if not can_resume(args, state, len(image)):
+            raise OtaError(f"update failed, state={upload_state}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device IP address or hostname")
+    parser.add_argument("image", help="firmware image, e.g. build/bonsai-growlab.bin")
+    image_type = parser.add_mutually_exclusive_group()
+    image_type.add_argument("--delta", action="store_true",
+                            help="image is the delta patch made by tools/ota_delta.py")
+    image_type.add_argument("--web-gui", action="store_true",
+                            help="image is the web GUI partition image")
+    parser.add_argument("--port", type=int, default=80, help="HTTP server port")
+    parser.add_argument("--token", default=os.environ.get("BONSAI_OTA_TOKEN"),
+                        help="access token, defaults to $BONSAI_OTA_TOKEN")
+    parser.add_argument("--part-size", type=int, default=64 * 1024,
+                        help="number of bytes sent per request")
+    parser.add_argument("--resume", action="store_true",
+                        help="continue the update started by the previous run")
+    parser.add_argument("--reboot", action="store_true",
+                        help="reboot into the new firmware when the update is ready")
+    parser.add_argument("--retries", type=int, default=10,
+                        help="number of consecutive failures before giving up")
+    parser.add_argument("--retry-delay", type=float, default=2.0,
+                        help="delay before retrying the failed part, in seconds")
+    parser.add_argument("--timeout", type=float, default=30.0, help="request timeout")
+
+    args = parser.parse_args()
+    if not args.token:
+        parser.error("access token is required, see --token")
+
+    try:
+        with open(args.image, "rb") as f:
+            image = f.read()
+
+        if args.web_gui:
+            image = image.rstrip(b"\xff") or image[:1]
+
+        state = upload(args, image)
+    except (OSError, OtaError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+    except KeyboardInterrupt:
+        return 1
+
+    if args.web_gui:
+        print("update ready, applied on the next boot", file=sys.stderr)
+        if not state.get("rollback", True):
+            print("warning: previous firmware was overwritten, rollback isn't possible",
+                  file=sys.stderr)
+    else:
+        print(f"update ready: partition={state.get('partition')}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Measure the HTTP request latency and throughput at each power save level.
+
+For each level, the level is set via GET /api/v1/config/power, then the telemetry
+endpoint is requested in two phases:
+  - idle: one request after each idle period, as a collector polling the device,
+    the radio is asleep when the request arrives.
+  - burst: back-to-back requests, the radio stays awake between them.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+import time
+import urllib.request
+
+LEVELS = ("none", "min", "max")
+
+
+def request(url, timeout):
+    start = time.monotonic()
+    with urllib.request.urlopen(url, timeout=timeout) as resp:
+        size = len(resp.read())
+    return time.monotonic() - start, size
+
+
+def percentile(values, p):
+    values = sorted(values)
+    index = min(len(values) - 1, max(0, round(p / 100 * len(values)) - 1))
+    return values[index]
+
+
+def summarize(latencies, failed, elapsed):
+    if not latencies:
+        return {"count": 0, "failed": failed}
+
+    ms = [v * 1000 for v in latencies]
+    return {
+        "count": len(ms),
+        "failed": failed,
+        "rps": round(len(ms) / elapsed, 2) if elapsed else None,
+        "mean_ms": round(statistics.mean(ms), 1),
+        "p50_ms": round(percentile(ms, 50), 1),
+        "p95_ms": round(percentile(ms, 95), 1),
+        "p99_ms": round(percentile(ms, 99), 1),
+        "max_ms": round(max(ms), 1),
+    }
+
+
+def run_phase(url, count, idle, timeout):
+    latencies = []
+    failed = 0
+    busy = 0.0
+
+    for _ in range(count):
+        if idle:
+            time.sleep(idle)
+        try:
+            latency, _ = request(url, timeout)
+            latencies.append(latency)
+            busy += latency
+        except Exception:
+            failed += 1
+
+    return summarize(latencies, failed, busy)
+
+
+def set_level(args, level):
+    url = f"http://{args.host}:{args.port}/api/v1/config/power?level={level}"
+    with urllib.request.urlopen(url, timeout=args.timeout) as resp:
+        state = json.load(resp)
+    if state.get("level") != level:
+        raise RuntimeError(f"failed to set level: {state}")
+    return state
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device IP address or hostname")
+    parser.add_argument("--port", type=int, default=80, help="HTTP server port")
+    parser.add_argument("--path", default="/api/v1/telemetry", help="requested path")
+    parser.add_argument("--levels", default=",".join(LEVELS),
+                        help="comma-separated power save levels")
+    parser.add_argument("--count", type=int, default=30, help="requests per phase")
+    parser.add_argument("--idle", type=float, default=2.0,
+                        help="idle period before each request in the idle phase, seconds")
+    parser.add_argument("--settle", type=float, default=3.0,
+                        help="delay after changing the level, seconds")
+    parser.add_argument("--timeout", type=float, default=10.0, help="request timeout")
+    parser.add_argument("--json", action="store_true", help="print results as JSON")
+    args = parser.parse_args()
+
+    url = f"http://{args.host}:{args.port}{args.path}"
+    results = []
+
+    levels = [level.strip() for level in args.levels.split(",") if level.strip()]
+
+    try:
+        for level in levels:
+            state = set_level(args, level)
+            time.sleep(args.settle)
+
+            print(f"measuring level={level}...", file=sys.stderr)
+
+            results.append({
+                "level": level,
+                "light_sleep": state.get("light_sleep"),
+                "idle": run_phase(url, args.count, args.idle, args.timeout),
+                "burst": run_phase(url, args.count, 0, args.timeout),
+            })
+    finally:
+        # Restore the lowest latency level, so the device stays easily reachable.
+        set_level(args, "none")
+
+    if args.json:
+        print(json.dumps(results, indent=2))
+        return
+
+    print(f"{'level':<6} {'phase':<6} {'rps':>7} {'p50':>8} {'p95':>8} {'p99':>8} "
+          f"{'max':>8} {'failed':>7}")
+    for result in results:
+        for phase in ("idle", "burst"):
+            r = result[phase]
+            if not r["count"]:
+                print(f"{result['level']:<6} {phase:<6} {'-':>7} {'-':>8} {'-':>8} "
+                      f"{'-':>8} {'-':>8} {r['failed']:>7}")
+                continue
+            rps = r["rps"] if phase == "burst" else "-"
+            print(f"{result['level']:<6} {phase:<6} {rps:>7} {r['p50_ms']:>8} "
+                  f"{r['p95_ms']:>8} {r['p99_ms']:>8} {r['max_ms']:>8} {r['failed']:>7}")
+
+
+if __name__ == "__main__":
+    main()
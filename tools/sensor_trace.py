@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Fetch, merge and inspect the raw sensor traces recorded by the device.
+
+The trace is available via GET /api/v1/diagnostic/sensor_trace if
+CONFIG_BONSAI_FIRMWARE_SENSOR_TRACE_ENABLE is set. The device keeps only the last
+records, so long captures are made with --follow, which polls the device and appends
+the new records to the output file. The file can be replayed on the host with
+SensorTraceReplayer, see docs/host/build.md.
+"""
+
+import argparse
+import struct
+import sys
+import time
+import urllib.request
+
+MAGIC = b"BSTR"
+VERSION = 1
+HEADER = struct.Struct("<4sBBH")
+RECORD = struct.Struct("<qihBB")
+
+# See status::StatusCode.
+STATUS_OK = 0
+
+
+class TraceError(Exception):
+    pass
+
+
+def parse(data):
+    """Return the list of records, each record is a tuple:
+    (timestamp, value, count, channel, code)."""
+    if len(data) < HEADER.size:
+        raise TraceError("trace is too short")
+
+    magic, version, record_size, _ = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise TraceError("invalid magic")
+    if version != VERSION or record_size != RECORD.size:
+        raise TraceError(f"unsupported version {version}, record size {record_size}")
+
+    count = (len(data) - HEADER.size) // RECORD.size
+    return [RECORD.unpack_from(data, HEADER.size + n * RECORD.size) for n in range(count)]
+
+
+def serialize(records):
+    data = bytearray(HEADER.pack(MAGIC, VERSION, RECORD.size, 0))
+    for record in records:
+        data += RECORD.pack(*record)
+    return bytes(data)
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        return parse(f.read())
+
+
+def fetch(args):
+    url = f"http://{args.host}:{args.port}/api/v1/diagnostic/sensor_trace"
+    with urllib.request.urlopen(url, timeout=args.timeout) as resp:
+        return parse(resp.read())
+
+
+def merge(records, new_records, state):
+    """Append the records which weren't seen yet, per channel.
+
+    Timestamps are counted from the device boot. If the device was restarted, the
+    new records are shifted after the already merged ones.
+    """
+    if new_records and state["last"] is not None:
+        if max(r[0] for r in new_records) < state["device_last"]:
+            print("device restarted, shifting timestamps", file=sys.stderr)
+            state["offset"] = state["last"] + 1
+            state["channels"] = {}
+            state["device_last"] = -1
+
+    for timestamp, value, count, channel, code in new_records:
+        if timestamp <= state["channels"].get(channel, -1):
+            continue
+
+        state["channels"][channel] = timestamp
+        state["device_last"] = max(state["device_last"], timestamp)
+
+        timestamp += state["offset"]
+        state["last"] = timestamp if state["last"] is None \
+            else max(state["last"], timestamp)
+
+        records.append((timestamp, value, count, channel, code))
+
+
+def cmd_fetch(args):
+    records = []
+    state = {"channels": {}, "offset": 0, "last": None, "device_last": -1}
+
+    while True:
+        try:
+            merge(records, fetch(args), state)
+        except Exception as e:
+            if not args.follow:
+                raise
+            print(f"failed to fetch trace: {e}", file=sys.stderr)
+
+        with open(args.output, "wb") as f:
+            f.write(serialize(records))
+
+        print(f"{len(records)} record(s) written to {args.output}", file=sys.stderr)
+
+        if not args.follow:
+            return 0
+
+        time.sleep(args.follow)
+
+
+def cmd_dump(args):
+    print("timestamp_us,channel,value,count,code")
+    for timestamp, value, count, channel, code in read_file(args.trace):
+        print(f"{timestamp},{channel},{value},{count},{code}")
+    return 0
+
+
+def cmd_summary(args):
+    records = read_file(args.trace)
+    if not records:
+        print("no records")
+        return 0
+
+    begin = min(r[0] for r in records)
+    end = max(r[0] for r in records)
+
+    print(f"records: {len(records)}")
+    print(f"duration: {(end - begin) / 1e6:.1f}s")
+
+    for channel in sorted({r[3] for r in records}):
+        ok = [r for r in records if r[3] == channel and r[4] == STATUS_OK]
+        failed = sum(1 for r in records if r[3] == channel and r[4] != STATUS_OK)
+
+        if ok:
+            values = [r[1] for r in ok]
+            print(f"channel {channel}: records={len(ok)} failed={failed} "
+                  f"min={min(values)} max={max(values)} "
+                  f"mean={sum(values) / len(values):.1f}")
+        else:
+            print(f"channel {channel}: records=0 failed={failed}")
+
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    fetch_parser = commands.add_parser("fetch", help="download the trace from the device")
+    fetch_parser.add_argument("host", help="device IP address or hostname")
+    fetch_parser.add_argument("--port", type=int, default=80,
+                              help="HTTP server port")
+    fetch_parser.add_argument("--output", required=True, help="trace file to write")
+    fetch_parser.add_argument("--follow", type=float, metavar="SECONDS",
+                              help="keep polling the device with the given interval")
+    fetch_parser.add_argument("--timeout", type=float, default=10.0,
+                              help="request timeout")
+
+    dump_parser = commands.add_parser("dump", help="print the trace records as CSV")
+    dump_parser.add_argument("trace", help="trace file")
+
+    summary_parser = commands.add_parser("summary", help="print per-channel statistics")
+    summary_parser.add_argument("trace", help="trace file")
+
+    args = parser.parse_args()
+
+    try:
+        if args.command == "fetch":
+            return cmd_fetch(args)
+        if args.command == "dump":
+            return cmd_dump(args)
+        return cmd_summary(args)
+    except (OSError, TraceError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2025, Open Control Systems authors
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+"""Convert the device activity trace to the Chrome trace event format.
+
+The trace is available via GET /api/v1/diagnostic/trace if
+CONFIG_BONSAI_FIRMWARE_TRACE_ENABLE is set. The output JSON can be opened in
+chrome://tracing or in the Perfetto UI (https://ui.perfetto.dev), each FreeRTOS task
+is shown as a separate track.
+"""
+
+import argparse
+import json
+import struct
+import sys
+import urllib.request
+
+MAGIC = b"BTRC"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHHHI")
+EVENT = struct.Struct("<qHHBB")
+
+UNKNOWN_TASK = 255
+
+# See TracePhase.
+PHASES = {0: "B", 1: "E", 2: "i"}
+
+
+class TraceError(Exception):
+    pass
+
+
+def read_strings(data, pos, count):
+    strings = []
+    for _ in range(count):
+        if pos >= len(data):
+            raise TraceError("truncated string table")
+        size = data[pos]
+        strings.append(data[pos + 1:pos + 1 + size].decode("utf-8", errors="replace"))
+        pos += 1 + size
+    return strings, pos
+
+
+def parse(data):
+    """Return (tasks, events), each event is (timestamp, name, category, task, phase)."""
+    if len(data) < HEADER.size:
+        raise TraceError("trace is too short")
+
+    magic, version, _, string_count, task_count, _, event_count = \
+        HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise TraceError("invalid magic")
+    if version != VERSION:
+        raise TraceError(f"unsupported version {version}")
+
+    strings, pos = read_strings(data, HEADER.size, string_count)
+    tasks, pos = read_strings(data, pos, task_count)
+
+    if pos + event_count * EVENT.size > len(data):
+        raise TraceError("truncated events")
+
+    events = []
+    for n in range(event_count):
+        timestamp, name, category, task, phase = \
+            EVENT.unpack_from(data, pos + n * EVENT.size)
+        events.append((timestamp, strings[name], strings[category], task, phase))
+
+    return tasks, events
+
+
+def convert(tasks, events):
+    trace = []
+
+    for task in sorted({e[3] for e in events}):
+        name = tasks[task] if task < len(tasks) else "unknown"
+        trace.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": task,
+                      "args": {"name": name}})
+
+    # Events which were begun before the oldest recorded event have no Begin.
+    depth = {}
+
+    for timestamp, name, category, task, phase in events:
+        ph = PHASES.get(phase)
+        if ph is None:
+            continue
+
+        if ph == "B":
+            depth[task] = depth.get(task, 0) + 1
+        elif ph == "E":
+            if not depth.get(task):
+                continue
+            depth[task] -= 1
+
+        event = {"ph": ph, "name": name, "cat": category, "ts": timestamp, "pid": 0,
+                 "tid": task}
+        if ph == "i":
+            event["s"] = "t"
+
+        trace.append(event)
+
+    return {"traceEvents": trace, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="device IP address or hostname, or trace file")
+    parser.add_argument("--port", type=int, default=80, help="HTTP server port")
+    parser.add_argument("--save", help="also save the raw trace to the file")
+    parser.add_argument("--output", help="output JSON file, stdout by default")
+    parser.add_argument("--timeout", type=float, default=10.0, help="request timeout")
+    args = parser.parse_args()
+
+    try:
+        try:
+            with open(args.source, "rb") as f:
+                data = f.read()
+        except FileNotFoundError:
+            url = f"http://{args.source}:{args.port}/api/v1/diagnostic/trace"
+            with urllib.request.urlopen(url, timeout=args.timeout) as resp:
+                data = resp.read()
+
+        if args.save:
+            with open(args.save, "wb") as f:
+                f.write(data)
+
+        tasks, events = parse(data)
+    except (OSError, TraceError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return 1
+
+    result = convert(tasks, events)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(result, f)
+    else:
+        json.dump(result, sys.stdout)
+        print()
+
+    print(f"{len(events)} event(s), {len(tasks)} task(s)", file=sys.stderr)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())